@@ -0,0 +1,27 @@
+#ifndef BICONNECTIVITY_ENGINE_H
+#define BICONNECTIVITY_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct Biconnectivity {
+        std::vector<int> bridges;
+        std::vector<int> articulationNodes;
+        std::vector<std::vector<int>> blocks;
+    };
+
+    class BiconnectivityEngine {
+
+    private:
+        BiconnectivityEngine() = default;
+
+    public:
+        // Iterative Hopcroft-Tarjan low-link pass over the underlying undirected graph. Bridges and
+        // blocks hold edge ids, articulation nodes are reported once each in id order.
+        static Biconnectivity analyze(const CompactGraph &graph);
+    };
+}
+
+#endif
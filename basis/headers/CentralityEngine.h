@@ -0,0 +1,59 @@
+#ifndef CENTRALITY_ENGINE_H
+#define CENTRALITY_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct Centrality {
+        std::vector<double> score;
+        int iterations = 0;
+        // false when max_iterations ran out first
+        bool converged = false;
+    };
+
+    struct Betweenness {
+        // unnormalised pair dependencies; in undirected graphs each unordered pair counts once
+        std::vector<double> node;
+        // by edge id; parallel arcs of an undirected edge are added together
+        std::vector<double> edge;
+        // sources the scores were accumulated from, scaled up to all n when sampled
+        int sources = 0;
+        bool exact = true;
+    };
+
+    // Power iterations that pull along in-arcs: each node sums over its own in-row of the CSR, so
+    // rows are written by one thread without atomics. Rows are split into blocks of about equal arc
+    // count that threads take dynamically; small graphs are one block and run inline. Weighted graphs
+    // use edge weights (negative as 0).
+    class CentralityEngine {
+
+    private:
+        CentralityEngine() = default;
+
+    public:
+        // Scores add up to 1; dangling nodes spread their score evenly. Stops when the L1 change of
+        // an iteration drops below tolerance.
+        static Centrality pageRank(const CompactGraph &graph, double damping = 0.85, double tolerance = 1e-9,
+                                   int max_iterations = 200);
+
+        // Principal eigenvector of the in-adjacency, scaled to unit length. Iterates with A + I,
+        // which has the same eigenvectors but does not oscillate on bipartite graphs. Graphs without
+        // cycles get all zeros at once.
+        static Centrality eigenvector(const CompactGraph &graph, double tolerance = 1e-9,
+                                      int max_iterations = 200);
+
+        // callers run every source up to this many nodes and sample defaultSamples sources beyond
+        static const int exactSourceLimit = 2048;
+        static const int defaultSamples = 256;
+
+        // Brandes: one BFS (Dijkstra on weighted graphs, weights below 1 count as 1) per source, then
+        // dependencies accumulated in reverse settle order by rescanning in-arcs instead of keeping
+        // predecessor lists. Sources run in parallel into per-thread totals merged at the end.
+        // samples > 0 and < n draws that many distinct sources with the seed and scales by n / samples.
+        static Betweenness betweenness(const CompactGraph &graph, int samples = 0, unsigned seed = 1);
+    };
+}
+
+#endif
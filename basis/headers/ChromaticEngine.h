@@ -0,0 +1,46 @@
+#ifndef CHROMATIC_ENGINE_H
+#define CHROMATIC_ENGINE_H
+
+#include "ColoringEngine.h"
+#include <cstdint>
+#include <vector>
+
+namespace GraphType {
+
+    struct ChromaticResult {
+        Coloring coloring;
+        int lowerBound = 0;
+        // the inclusion-exclusion estimate: almost surely the chromatic number, but not proven
+        int probableBound = 0;
+        bool optimal = false;
+    };
+
+    // Exact colouring of graphs with at most 64 nodes over one 64-bit adjacency mask per node, taken
+    // from a SmallGraph<64> that also supplies the clique lower bound and a greedy class colouring.
+    class ChromaticEngine {
+
+    private:
+        ChromaticEngine() = default;
+
+    public:
+        static const int exactLimit = 64;
+        static const int inclusionExclusionLimit = 22;
+
+        static std::vector<std::uint64_t> adjacencyMasks(const CompactGraph &graph);
+
+        // Smallest k in [lower, upper) for which the inclusion-exclusion count of k-covers by independent
+        // sets is non-zero, or upper if there is none. Counts are taken modulo two primes, so a non-zero
+        // answer proves k-colourability, while zero under both only makes the opposite overwhelmingly
+        // likely; solve() leaves that proof to the branch and bound.
+        static int inclusionExclusion(const std::vector<std::uint64_t> &adjacency, int lower, int upper);
+
+        // Exact DSatur search starting from a known colouring; stops as soon as it meets lower_bound.
+        // optimal is set when the search finished, proving no colouring below the result exists.
+        static ChromaticResult branchAndBound(const std::vector<std::uint64_t> &adjacency, const Coloring &initial,
+                                              int lower_bound, int time_limit_ms);
+
+        static ChromaticResult solve(const CompactGraph &graph, int time_limit_ms = 5000);
+    };
+}
+
+#endif
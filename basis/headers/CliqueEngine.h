@@ -0,0 +1,35 @@
+#ifndef CLIQUE_ENGINE_H
+#define CLIQUE_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct CliqueResult {
+        std::vector<int> nodes;
+        bool optimal = true;
+    };
+
+    // Maximum cliques of the underlying undirected graph. Each top-level branch fixes one node and
+    // searches only its candidates that come later in the branch order, as a dense bitset subgraph
+    // pruned by greedy colour classes (Tomita's MCQ); branches are shared out between threads.
+    class CliqueEngine {
+
+    private:
+        CliqueEngine() = default;
+
+    public:
+        // the complement is held as a dense bitset matrix, so independent sets are limited to this many nodes
+        static const int complementLimit = 4096;
+
+        // Branches follow a degeneracy order, so no branch holds more candidates than the degeneracy.
+        // Graphs that fit a SmallGraph are searched in one piece over its bitset rows instead.
+        static CliqueResult maximumClique(const CompactGraph &graph, int time_limit_ms = 10000);
+
+        // Maximum clique of the complement graph
+        static CliqueResult maximumIndependentSet(const CompactGraph &graph, int time_limit_ms = 10000);
+    };
+}
+
+#endif
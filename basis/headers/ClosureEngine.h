@@ -0,0 +1,67 @@
+#ifndef CLOSURE_ENGINE_H
+#define CLOSURE_ENGINE_H
+
+#include "CompactGraph.h"
+#include <cstdint>
+#include <vector>
+
+namespace GraphType {
+
+    // Row-major boolean matrix, each row packed into 64-bit words
+    class BitMatrix {
+
+    private:
+        int _rows;
+        int _cols;
+        int _words;
+        std::vector<std::uint64_t> _bits;
+
+    public:
+        explicit BitMatrix(int rows = 0, int cols = 0) :
+                _rows(rows), _cols(cols), _words((cols + 63) / 64), _bits((size_t) rows * ((cols + 63) / 64)) {}
+
+        int rows() const { return this->_rows; }
+
+        int cols() const { return this->_cols; }
+
+        int words() const { return this->_words; }
+
+        std::uint64_t *row(int r) { return this->_bits.data() + (size_t) r * _words; }
+
+        const std::uint64_t *row(int r) const { return this->_bits.data() + (size_t) r * _words; }
+
+        bool test(int r, int c) const { return (row(r)[c >> 6] >> (c & 63)) & 1; }
+
+        void set(int r, int c) { row(r)[c >> 6] |= std::uint64_t(1) << (c & 63); }
+
+        long long count() const;
+    };
+
+    // Transitive closure: row u holds v when a non-empty path u -> v exists, so u holds itself only
+    // when it lies on a cycle.
+    class ClosureEngine {
+
+    private:
+        ClosureEngine() = default;
+
+    public:
+        // a closure takes n * n bits; larger graphs are refused by the callers
+        static const int nodeLimit = 1 << 15;
+
+        static BitMatrix adjacency(const CompactGraph &graph);
+
+        // Four-Russians product: the rows of b are taken eight at a time and all 256 unions of each
+        // group are tabulated, so every row of the result needs one table lookup per byte of a.
+        static BitMatrix multiply(const BitMatrix &a, const BitMatrix &b);
+
+        // Closure of a square matrix by squaring R = R | R * R until it stops changing
+        static BitMatrix squaring(const BitMatrix &adjacency);
+
+        // Condenses the strongly connected components, closes the condensation either by word-parallel
+        // row ORs in reverse topological order (one height at a time, in parallel) or, when the DAG is
+        // dense and shallow, by squaring; then expands component rows back to nodes.
+        static BitMatrix transitiveClosure(const CompactGraph &graph);
+    };
+}
+
+#endif
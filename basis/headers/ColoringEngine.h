@@ -0,0 +1,46 @@
+#ifndef COLORING_ENGINE_H
+#define COLORING_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    enum ColoringStrategy {
+        SmallestLast, DSatur, JonesPlassmann
+    };
+
+    struct Coloring {
+        std::vector<int> color;
+        int count = 0;
+    };
+
+    // Colourings of the underlying undirected graph; self-loops are ignored.
+    class ColoringEngine {
+
+    private:
+        ColoringEngine() = default;
+
+    public:
+        // Matula-Beck bucket queue; removing each node in turn at minimum remaining degree
+        static std::vector<int> smallestLastOrder(const CompactGraph &graph);
+
+        // First-fit over the order given, with neighbour colours marked in a reusable bitset
+        static Coloring greedy(const CompactGraph &graph, const std::vector<int> &order);
+
+        static Coloring smallestLast(const CompactGraph &graph);
+
+        // Always colours the node that sees the most distinct colours next, breaking ties by degree
+        static Coloring dsatur(const CompactGraph &graph, int first = -1);
+
+        // Colours each node once every neighbour with a higher random priority is coloured; each round
+        // of released nodes is an independent set and runs in parallel, O(V+E) work overall.
+        static Coloring jonesPlassmann(const CompactGraph &graph);
+
+        static Coloring color(const CompactGraph &graph, ColoringStrategy strategy);
+
+        static bool isProper(const CompactGraph &graph, const Coloring &coloring);
+    };
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef COMMUNITY_ENGINE_H
+#define COMMUNITY_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct Communities {
+        // community[v] is in [0, count), numbered by first appearance in node order
+        std::vector<int> community;
+        int count = 0;
+        double modularity = 0;
+        // aggregation levels for Louvain, label sweeps for label propagation
+        int rounds = 0;
+    };
+
+    // Community detection on the underlying undirected graph: opposite arcs add up, weights count
+    // when the graph is weighted (negative as 0) and self-loops add to their node's own weight.
+    class CommunityEngine {
+
+    private:
+        CommunityEngine() = default;
+
+    public:
+        // Newman-Girvan modularity of a partition
+        static double modularity(const CompactGraph &graph, const std::vector<int> &community);
+
+        // Louvain: local moving, then every community collapses into one node, until a level
+        // moves nothing. Threads move the nodes of their blocks in place, seeing each other's moves,
+        // with community totals kept in atomics; a sweep that lowers modularity is undone. A level
+        // stops once a sweep gains less than tolerance or after max_sweeps sweeps, since weakly
+        // clustered graphs otherwise creep on with tiny gains for hundreds of sweeps.
+        static Communities louvain(const CompactGraph &graph, double tolerance = 1e-6, int max_sweeps = 32);
+
+        // Asynchronous label propagation: nodes take their neighbours' heaviest label in place, in a
+        // shuffled order split across threads, until a sweep changes nothing; ties keep the current
+        // label or are broken at random. Near-linear per sweep, meant for graphs too big for Louvain.
+        static Communities labelPropagation(const CompactGraph &graph, int max_iterations = 100, unsigned seed = 1);
+    };
+}
+
+#endif
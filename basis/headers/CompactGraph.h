@@ -0,0 +1,114 @@
+#ifndef COMPACT_GRAPH_H
+#define COMPACT_GRAPH_H
+
+#include "Graph.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace GraphType {
+
+    struct CompactEdge {
+        int u;
+        int v;
+        int weight;
+    };
+
+    // Read-only CSR snapshot of a Graph. Nodes get dense ids in nodeList() order and every
+    // adjacency row is sorted by id, so traversals visit neighbours in the same order as the
+    // name-based scans in GraphUtils. An undirected edge is stored as two arcs sharing one edge id.
+    class CompactGraph {
+
+    private:
+        bool _directed;
+        bool _weighted;
+        std::vector<std::string> _names;
+        std::unordered_map<std::string, int> _ids;
+        std::vector<CompactEdge> _edges;
+
+        std::vector<int> _outOffsets;
+        std::vector<int> _outTargets;
+        std::vector<int> _outEdges;
+
+        std::vector<int> _inOffsets;
+        std::vector<int> _inSources;
+        std::vector<int> _inEdges;
+
+        static void _buildRows(int node_num, const std::vector<CompactEdge> &edges, bool reversed, bool both_ways,
+                               std::vector<int> &offsets, std::vector<int> &targets, std::vector<int> &edge_ids);
+
+    public:
+        explicit CompactGraph(const Graph &graph);
+
+        bool isDirected() const { return this->_directed; }
+
+        bool isWeighted() const { return this->_weighted; }
+
+        int countNodes() const { return (int) this->_names.size(); }
+
+        int countEdges() const { return (int) this->_edges.size(); }
+
+        int countArcs() const { return (int) this->_outTargets.size(); }
+
+        int id(const std::string &node_name) const;
+
+        const std::string &name(int id) const { return this->_names[id]; }
+
+        const std::vector<std::string> &names() const { return this->_names; }
+
+        const std::vector<CompactEdge> &edges() const { return this->_edges; }
+
+        const CompactEdge &edge(int edge_id) const { return this->_edges[edge_id]; }
+
+        int outBegin(int u) const { return this->_outOffsets[u]; }
+
+        int outEnd(int u) const { return this->_outOffsets[u + 1]; }
+
+        int outDegree(int u) const { return outEnd(u) - outBegin(u); }
+
+        int target(int arc) const { return this->_outTargets[arc]; }
+
+        int arcEdge(int arc) const { return this->_outEdges[arc]; }
+
+        int weight(int arc) const { return this->_edges[this->_outEdges[arc]].weight; }
+
+        int inBegin(int v) const { return this->_inOffsets[v]; }
+
+        int inEnd(int v) const { return this->_inOffsets[v + 1]; }
+
+        int inDegree(int v) const { return inEnd(v) - inBegin(v); }
+
+        int source(int in_arc) const { return this->_inSources[in_arc]; }
+
+        int inArcEdge(int in_arc) const { return this->_inEdges[in_arc]; }
+
+        int inWeight(int in_arc) const { return this->_edges[this->_inEdges[in_arc]].weight; }
+
+        int maxWeight() const;
+
+        // Calls visit(w, edge_id) once for each distinct neighbour w != u of the underlying undirected
+        // graph, by ascending w, merging the sorted out- and in-rows of directed graphs. Parallel arcs
+        // report the edge of the first one found.
+        template<class Visit>
+        void forSimpleNeighbours(int u, Visit visit) const {
+            int a = outBegin(u), a_end = outEnd(u);
+            int b = this->_directed ? inBegin(u) : 0, b_end = this->_directed ? inEnd(u) : 0;
+            int last = -1;
+            while (a < a_end || b < b_end) {
+                int w, edge_id;
+                if (b == b_end || (a < a_end && target(a) <= source(b))) {
+                    w = target(a);
+                    edge_id = arcEdge(a++);
+                } else {
+                    w = source(b);
+                    edge_id = inArcEdge(b++);
+                }
+                if (w != u && w != last)
+                    visit(w, edge_id);
+                last = w;
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef COMPONENT_ENGINE_H
+#define COMPONENT_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct ComponentLabels {
+        std::vector<int> component;
+        int count = 0;
+
+        std::vector<std::vector<int>> groups() const;
+    };
+
+    class ComponentEngine {
+
+    private:
+        ComponentEngine() = default;
+
+    public:
+        // Iterative Tarjan; component ids follow a topological order of the condensation,
+        // i.e. every arc u -> v between components satisfies component[u] < component[v].
+        static ComponentLabels stronglyConnected(const CompactGraph &graph);
+
+        // One traversal along the arcs and one against them from node 0; both must reach every node.
+        static bool isStronglyConnected(const CompactGraph &graph);
+
+        // Afforest: links a couple of sampled neighbours per node, then sweeps the edge array once in
+        // parallel, skipping edges already inside the dominant component. Ids follow first appearance.
+        static ComponentLabels weaklyConnected(const CompactGraph &graph, int neighbour_rounds = 2);
+    };
+}
+
+#endif
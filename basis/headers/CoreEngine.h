@@ -0,0 +1,38 @@
+#ifndef CORE_ENGINE_H
+#define CORE_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct CoreDecomposition {
+        // core[v] is the largest k such that v belongs to the k-core
+        std::vector<int> core;
+        // largest core number in the graph
+        int degeneracy = 0;
+    };
+
+    // k-cores of the underlying simple undirected graph: directions are dropped, reciprocal arcs
+    // merge into one edge and self-loops are ignored. The k-core is the largest subgraph in which
+    // every node has at least k neighbours.
+    class CoreEngine {
+
+    private:
+        CoreEngine() = default;
+
+    public:
+        // Batagelj-Zaversnik: nodes bucket-sorted by degree and peeled from the lowest bucket, each
+        // neighbour moved down one bucket in O(1); O(V + E).
+        static CoreDecomposition batageljZaversnik(const CompactGraph &graph);
+
+        // Level-synchronous peeling: at level k every remaining node of degree <= k is removed at
+        // once, in parallel, and neighbours whose degree drops to k join the same level through
+        // atomic decrements. Remaining nodes are compacted after each level.
+        static CoreDecomposition parallelPeeling(const CompactGraph &graph);
+
+        static CoreDecomposition decompose(const CompactGraph &graph);
+    };
+}
+
+#endif
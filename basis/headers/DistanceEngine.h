@@ -0,0 +1,75 @@
+#ifndef DISTANCE_ENGINE_H
+#define DISTANCE_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    // Hop distances seen from one BFS source
+    struct Reach {
+        // greatest distance to a node the source reaches
+        int eccentricity = 0;
+        // reached nodes, the source included
+        int reached = 0;
+        long long distances = 0;
+    };
+
+    struct Eccentricities {
+        std::vector<int> eccentricity;
+        // Wasserman-Faust closeness: (r - 1)^2 / ((n - 1) * sum of distances) over the r nodes v reaches
+        std::vector<double> closeness;
+        int diameter = 0;
+        int radius = 0;
+        // whether every node reaches every other one
+        bool connected = true;
+        // nodes traversed from; when sampled the rest are left at 0 and the diameter and radius only
+        // range over the sampled nodes
+        std::vector<int> sources;
+        bool exact = true;
+    };
+
+    struct Diameter {
+        int lower = 0;
+        int upper = 0;
+        // BFS traversals spent, counting each source of a multi-source batch
+        int traversals = 0;
+
+        bool exact() const { return lower == upper; }
+    };
+
+    // Unweighted distances along the arcs; eccentricities only count the nodes a node reaches, so an
+    // isolated node has eccentricity 0 and the diameter of a disconnected graph is the largest over
+    // its components.
+    class DistanceEngine {
+
+    private:
+        DistanceEngine() = default;
+
+    public:
+        // sources traversed together by one multi-source BFS
+        static const int batchSize = 256;
+        // callers compute every node's eccentricity up to this many nodes and single nodes beyond
+        static const int exactNodeLimit = 5000;
+        // sources sampled beyond exactNodeLimit
+        static const int defaultSamples = 256;
+
+        // Multi-source BFS: each node keeps a bitset of the batch sources that reached it, so one pass
+        // over a frontier node's arcs advances up to 256 traversals with a few word operations.
+        // Batches run in parallel, one per thread.
+        static std::vector<Reach> traverse(const CompactGraph &graph, const std::vector<int> &sources);
+
+        // From a multi-source BFS out of every node; samples > 0 and < n draws that many distinct
+        // sources with the seed instead.
+        static Eccentricities eccentricities(const CompactGraph &graph, int samples = 0, unsigned seed = 1);
+
+        // iFUB on each weakly connected component: a BFS from a central node found by a double sweep
+        // splits the nodes into levels, whose eccentricities are computed from the deepest level up
+        // until no pair within the remaining levels can beat the best found. Usually exact after a
+        // handful of batches; max_traversals > 0 stops early with bounds. Directed graphs fall back
+        // to eccentricities(), sampled down to max_traversals sources when that is less than n.
+        static Diameter diameter(const CompactGraph &graph, int max_traversals = 0);
+    };
+}
+
+#endif
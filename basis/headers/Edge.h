@@ -11,7 +11,7 @@ namespace std {
         operator()(const pair<T1, T2> &p) const {
             auto hash1 = hash<T1>{}(p.first);
             auto hash2 = hash<T2>{}(p.second);
-            return hash1 ^ hash2;
+            return hash1 ^ (hash2 + 0x9e3779b97f4a7c15ULL + (hash1 << 6) + (hash1 >> 2));
         }
     };
 }
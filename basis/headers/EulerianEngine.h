@@ -0,0 +1,34 @@
+#ifndef EULERIAN_ENGINE_H
+#define EULERIAN_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    enum EulerianKind {
+        NoTrail, OpenTrail, ClosedTrail
+    };
+
+    struct EulerianTrail {
+        EulerianKind kind = NoTrail;
+        std::vector<int> nodes;
+    };
+
+    class EulerianEngine {
+
+    private:
+        EulerianEngine() = default;
+
+    public:
+        static EulerianKind classify(const CompactGraph &graph, int &start);
+
+        // Iterative Hierholzer with one cursor per node and a used-edge bitset, O(V+E). A closed trail
+        // starts and ends at source when it has edges; an open trail always starts at its odd node.
+        static EulerianTrail find(const CompactGraph &graph, int source = -1);
+
+        static std::vector<int> rotate(const std::vector<int> &circuit, int source);
+    };
+}
+
+#endif
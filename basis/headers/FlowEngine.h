@@ -0,0 +1,45 @@
+#ifndef FLOW_ENGINE_H
+#define FLOW_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    enum FlowAlgorithm {
+        Dinic, PushRelabel
+    };
+
+    struct FlowResult {
+        long long value = 0;
+        // net flow along each edge id, from edge.u to edge.v
+        std::vector<long long> flow;
+        // nodes still reachable from the source in the final residual network
+        std::vector<char> sourceSide;
+        // edge ids leaving sourceSide; their capacities add up to value
+        std::vector<int> cut;
+    };
+
+    // s-t maximum flow with edge weights as capacities (negative weights count as 0). An undirected
+    // edge is one pair of opposite arcs that both start with the full capacity. Both algorithms run
+    // on a residual CSR where each arc stores the position of its reverse arc.
+    class FlowEngine {
+
+    private:
+        FlowEngine() = default;
+
+    public:
+        // BFS levels from the source, then blocking flows by iterative DFS with a current-arc pointer
+        static FlowResult dinic(const CompactGraph &graph, int source, int sink);
+
+        // Highest-label push-relabel with global relabelling by reverse BFS. Nodes that can no longer
+        // reach the sink get labels above n and return their excess to the source, so the result is a
+        // flow, not just a preflow.
+        static FlowResult pushRelabel(const CompactGraph &graph, int source, int sink);
+
+        static FlowResult maxFlow(const CompactGraph &graph, int source, int sink,
+                                  FlowAlgorithm algorithm = PushRelabel);
+    };
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "Node.h"
 #include "Edge.h"
 #include "Matrix.h"
+#include "utils/unionfind.h"
 #include <utility>
 #include <vector>
 #include <list>
@@ -26,6 +27,19 @@ namespace GraphType {
         const bool _weighted;
         const int _invalidValue;
         const std::pair<int, int> _weightRange;
+        unsigned long long _revision;
+        // Weakly connected components, kept only while _trackComponents is set; insertions unite
+        // sets in place, removals leave them stale until the next query rebuilds them.
+        bool _trackComponents = false;
+        mutable bool _componentsStale = true;
+        mutable UnionFind _components;
+        mutable std::unordered_map<const Node *, int> _componentIds;
+
+        static unsigned long long _nextRevision();
+
+        void _buildComponents(UnionFind &sets, std::unordered_map<const Node *, int> &ids) const;
+
+        void _touch() { this->_revision = _nextRevision(); }
 
         static int _calcInvalid(bool directed, bool weighted) {
             return directed ? (weighted ? INT_MAX : 0) : 0;
@@ -44,7 +58,8 @@ namespace GraphType {
                 _directed(directed),
                 _weighted(weighted),
                 _invalidValue(_calcInvalid(directed, weighted)),
-                _weightRange(_calcWeightRange(weighted)) {}
+                _weightRange(_calcWeightRange(weighted)),
+                _revision(_nextRevision()) {}
 
         explicit Graph(int node_num, bool directed, bool weighted);
 
@@ -62,8 +77,20 @@ namespace GraphType {
 
         std::pair<int, int> weightRange() const { return this->_weightRange; }
 
+        // Unique across all graphs and bumped on every structural change, so it can key result caches.
+        unsigned long long revision() const { return this->_revision; }
+
         void clear();
 
+        // Opts in to keeping weakly connected components up to date under edits, in near-constant
+        // time for added nodes and edges
+        void trackComponents(bool enabled = true);
+
+        bool tracksComponents() const { return this->_trackComponents; }
+
+        // Weakly connected components; a full union-find pass over the edges unless tracked
+        int countComponents() const;
+
         static Graph readFromFile(const std::string &file);
 
         static void writeToFile(const std::string &file, const Graph &graph);
@@ -136,7 +163,11 @@ namespace GraphType {
 
         int weight(const std::string &uname, const std::string &vname) const;
 
-        void clearEdges() { this->_edgeSet.clear(); }
+        void clearEdges() {
+            this->_edgeSet.clear();
+            this->_componentsStale = true;
+            _touch();
+        }
 
         Graph transpose() const;
 
@@ -2,9 +2,14 @@
 #define GRAPH_UTILS_H
 
 #include "Graph.h"
+#include "ShortestPathEngine.h"
+#include "ColoringEngine.h"
+#include "ClosureEngine.h"
+#include "FlowEngine.h"
 #include <queue>
 #include <stack>
 #include <list>
+#include <vector>
 
 using namespace GraphType;
 
@@ -26,12 +31,25 @@ public:
 
     static std::list<std::pair<std::string, std::string>> DFSToDemo(const Graph *graph, const std::string &source);
 
-    static std::list<std::string> Dijkstra(const Graph *graph, const std::string &start, const std::string &goal);
+    static std::list<std::string> Dijkstra(const Graph *graph, const std::string &start, const std::string &goal,
+                                           ShortestPathBackend backend = ShortestPathBackend::BinaryHeap);
+
+    static std::list<std::pair<std::string, long long>>
+    shortestDistances(const Graph *graph, const std::string &source,
+                      ShortestPathBackend backend = ShortestPathBackend::DeltaStepping);
+
+    // Prints the distance of every node reached from source; nearer nodes score higher
+    static std::list<std::pair<std::string, double>> displayShortestDistances(const Graph *graph,
+                                                                               const std::string &source);
 
     static std::list<std::pair<std::string, std::string>> usualST(const Graph *graph, const std::string &source = "");
 
+    // Without a source: the minimum spanning tree, or the whole forest when the graph is not connected
     static std::list<std::pair<std::string, std::string>> Prim(const Graph *graph, std::string source = "");
 
+    // The minimum spanning forest's edges, one list per tree
+    static std::list<std::list<std::pair<std::string, std::string>>> minimumSpanningForest(const Graph *graph);
+
     static std::list<std::list<std::string>> connectedComponents(const Graph *graph);
 
     static std::list<std::list<std::string>> weaklyConnectedComponents(const Graph *graph);
@@ -44,17 +62,25 @@ public:
 
     static bool isConnectedFromUtoV(const Graph *graph, const std::string &uname, const std::string &vname);
 
+    // Answers many u -> v queries from one reachability index of the current graph
+    static std::vector<bool> areConnected(const Graph *graph,
+                                          const std::vector<std::pair<std::string, std::string>> &queries);
+
     static bool isAllStronglyConnected(const Graph *graph);
 
     static bool isAllWeaklyConnected(const Graph *graph);
 
     static std::list<std::string> getArticulationNodes(const Graph *graph);
 
+    static std::list<std::list<std::pair<std::string, std::string>>> getBiconnectedComponents(const Graph *graph);
+
     static std::list<std::string> displayArticulationNodes(const Graph *graph);
 
     static std::list<std::string> getHamiltonianCycle(const Graph *graph, std::string source = "");
 
-    static std::list<std::string> getEulerianCircuit(const Graph *_graph, std::string source = "");
+    static std::list<std::string> getEulerianCircuit(const Graph *graph, std::string source = "");
+
+    static std::list<std::string> getEulerianPath(const Graph *graph);
 
     static std::list<std::list<std::string>> displayHamiltonianCycle(const Graph *graph);
 
@@ -62,17 +88,142 @@ public:
 
     static std::list<std::string> getTopoSortResult(const Graph *graph);
 
+    static std::list<std::list<std::string>> getTopoLevels(const Graph *graph);
+
     static std::list<std::string> displayTopoSort(const Graph *graph);
 
-    static std::list<std::pair<std::string, int>> getColoringResult(const Graph *graph, std::string source = "");
+    static std::list<std::pair<std::string, int>>
+    getColoringResult(const Graph *graph, std::string source = "", ColoringStrategy strategy = DSatur);
 
     static std::list<std::pair<std::string, std::string>> displayColoring(const Graph *graph, std::string source = "");
 
+    static std::list<std::pair<std::string, std::string>>
+    displayChromaticNumber(const Graph *graph, int time_limit_ms = 5000);
+
     static bool isCycle(const Graph *graph);
 
+    static std::list<std::string> getMaximumClique(const Graph *graph);
+
+    static std::list<std::string> getMaximumIndependentSet(const Graph *graph);
+
+    static std::list<std::list<std::string>> displayMaximumClique(const Graph *graph);
+
+    static std::list<std::list<std::string>> displayMaximumIndependentSet(const Graph *graph);
+
+    // Row i holds j when a path leads from the i-th to the j-th node of nodeList(); empty when the
+    // graph has more than ClosureEngine::nodeLimit nodes
+    static BitMatrix getTransitiveClosure(const Graph *graph);
+
+    static BitMatrix displayTransitiveClosure(const Graph *graph);
+
+    // Edge weights are the capacities
+    static long long getMaxFlow(const Graph *graph, const std::string &source, const std::string &sink,
+                                FlowAlgorithm algorithm = PushRelabel);
+
+    static std::list<std::pair<std::string, std::string>>
+    getMinCut(const Graph *graph, const std::string &source, const std::string &sink);
+
+    // The two sides of a global minimum cut of the underlying undirected graph
+    static std::list<std::list<std::string>> getMinimumCut(const Graph *graph, int trials = 0);
+
+    static std::list<std::list<std::string>> displayMinimumCut(const Graph *graph, int trials = 0);
+
+    static bool isBipartite(const Graph *graph);
+
+    // Maximum weight matching (Hungarian) for weighted graphs up to MatchingEngine::hungarianLimit
+    // nodes, otherwise maximum cardinality matching (Hopcroft-Karp); empty unless the graph is bipartite
+    static std::list<std::pair<std::string, std::string>> getMaximumMatching(const Graph *graph);
+
+    static std::list<std::pair<std::string, std::string>> displayMaximumMatching(const Graph *graph);
+
+    // PageRank and eigenvector centrality, computed once per graph revision
+    static std::list<std::pair<std::string, double>> getPageRank(const Graph *graph);
+
+    static std::list<std::pair<std::string, double>> getEigenvectorCentrality(const Graph *graph);
+
+    static double getPageRank(const Graph *graph, const std::string &node);
+
+    static double getEigenvectorCentrality(const Graph *graph, const std::string &node);
+
+    static std::list<std::pair<std::string, double>> displayPageRank(const Graph *graph, int top = 20);
+
+    static std::list<std::pair<std::string, double>> displayEigenvectorCentrality(const Graph *graph, int top = 20);
+
+    // The has* queries tell whether a per-node metric is already computed for the graph's current
+    // revision, so that reading one node's value is cheap
+    static bool hasCentrality(const Graph *graph);
+
+    // Betweenness centrality, estimated from CentralityEngine::defaultSamples sources above
+    // CentralityEngine::exactSourceLimit nodes; computed once per graph revision
+    static std::list<std::pair<std::string, double>> getBetweenness(const Graph *graph);
+
+    static double getBetweenness(const Graph *graph, const std::string &node);
+
+    static double getEdgeBetweenness(const Graph *graph, const std::string &uname, const std::string &vname);
+
+    static std::list<std::pair<std::string, double>> displayBetweenness(const Graph *graph, int top = 20);
+
+    static bool hasBetweenness(const Graph *graph);
+
+    // Triangles and clustering coefficients of the underlying simple undirected graph
+    static long long getTriangleCount(const Graph *graph);
+
+    static double getClusteringCoefficient(const Graph *graph, const std::string &node);
+
+    static std::list<std::pair<std::string, double>> displayClustering(const Graph *graph, int top = 20);
+
+    static bool hasClustering(const Graph *graph);
+
+    // Core numbers of the underlying simple undirected graph, computed once per graph revision
+    static std::list<std::pair<std::string, int>> getCoreNumbers(const Graph *graph);
+
+    static int getCoreNumber(const Graph *graph, const std::string &node);
+
+    static int getDegeneracy(const Graph *graph);
+
+    static bool hasCoreNumbers(const Graph *graph);
+
+    // Nodes of the k-core: every one of them has at least k neighbours among the others
+    static std::list<std::string> getKCore(const Graph *graph, int k);
+
+    static std::list<std::string> displayKCore(const Graph *graph, int k);
+
+    // Communities by Louvain, or by label propagation for very large graphs, largest first
+    static std::list<std::list<std::string>> getCommunities(const Graph *graph, bool label_propagation = false);
+
+    static std::list<std::list<std::string>> displayCommunities(const Graph *graph, bool label_propagation = false);
+
+    // Hop distances, weights ignored; unreachable nodes don't count. The diameter of an undirected
+    // graph comes from iFUB, everything else from eccentricities of every node up to
+    // DistanceEngine::exactNodeLimit nodes; -1 when the graph is over that limit.
+    static int getDiameter(const Graph *graph);
+
+    // Lower and upper bound on the diameter after at most about max_traversals BFS traversals, equal
+    // when exact; 0 puts no limit.
+    static std::pair<int, int> getDiameterBounds(const Graph *graph, int max_traversals = 0);
+
+    static int getRadius(const Graph *graph);
+
+    static int getEccentricity(const Graph *graph, const std::string &node);
+
+    // Beyond DistanceEngine::exactNodeLimit nodes only the sampled nodes are listed
+    static std::list<std::pair<std::string, double>> getClosenessCentrality(const Graph *graph);
+
+    static double getClosenessCentrality(const Graph *graph, const std::string &node);
+
+    static std::list<std::pair<std::string, double>> displayCloseness(const Graph *graph, int top = 20);
+
+    // Eccentricity and closeness of the node: those of every node up to DistanceEngine::exactNodeLimit
+    // nodes, beyond that a BFS from the node itself
+    static bool hasDistances(const Graph *graph, const std::string &node);
+
+    static std::list<std::pair<std::string, std::string>>
+    displayMaxFlow(const Graph *graph, const std::string &source, const std::string &sink,
+                   FlowAlgorithm algorithm = PushRelabel);
+
     static std::list<std::string> AStar(const Graph *graph, std::string start, std::string goal);
 
-    static std::list<std::string> Hierholzer(Graph &graph, std::string source);
+    static std::list<std::string> Hierholzer(const Graph &graph, std::string source);
 };
 
 #endif
@@ -0,0 +1,39 @@
+#ifndef HAMILTONIAN_ENGINE_H
+#define HAMILTONIAN_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    enum HamiltonianStatus {
+        CycleFound, NoCycle, SearchTimedOut
+    };
+
+    struct HamiltonianResult {
+        HamiltonianStatus status = NoCycle;
+        std::vector<int> cycle;
+    };
+
+    // Every cycle is returned starting at node 0; the cycle from any other start is a rotation of it.
+    class HamiltonianEngine {
+
+    private:
+        HamiltonianEngine() = default;
+
+    public:
+        static const int heldKarpLimit = 25;
+
+        // Bitmask DP: reach[mask] holds the set of end nodes of paths from node 0 covering exactly mask.
+        // Adjacency masks come from a SmallGraph, whose bitset BFS first rules out disconnected graphs.
+        static HamiltonianResult heldKarp(const CompactGraph &graph);
+
+        // Depth-first search from node 0 split across threads by its first two steps, with dead-end
+        // degree pruning, periodic connectivity checks and a wall-clock budget.
+        static HamiltonianResult branchAndBound(const CompactGraph &graph, int time_limit_ms);
+
+        static HamiltonianResult findCycle(const CompactGraph &graph, int time_limit_ms = 10000);
+    };
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef MATCHING_ENGINE_H
+#define MATCHING_ENGINE_H
+
+#include "CompactGraph.h"
+#include "Matrix.h"
+#include <utility>
+#include <vector>
+
+namespace GraphType {
+
+    struct Bipartition {
+        bool bipartite = true;
+        // side[v] is 0 or 1; the first node of every component is put on side 0
+        std::vector<char> side;
+        // node ids of an odd cycle, in order, when the graph is not bipartite
+        std::vector<int> oddCycle;
+    };
+
+    struct Matching {
+        long long weight = 0;
+        // mate[v] is the node matched with v, or -1
+        std::vector<int> mate;
+        // matched edge ids (hopcroftKarp) or matched pairs of matrix indices (hungarian)
+        std::vector<int> edges;
+        std::vector<std::pair<int, int>> pairs;
+    };
+
+    // Bipartite matching on the underlying undirected graph: edge directions are ignored, and a
+    // self-loop is an odd cycle of length one.
+    class MatchingEngine {
+
+    private:
+        MatchingEngine() = default;
+
+    public:
+        // the Hungarian algorithm is O(V^3) on a dense matrix; larger graphs are matched by cardinality
+        static const int hungarianLimit = 2000;
+
+        // BFS 2-colouring in O(V + E)
+        static Bipartition bipartition(const CompactGraph &graph);
+
+        // Maximum cardinality matching: BFS layers from all free left nodes, then vertex-disjoint
+        // shortest augmenting paths by iterative DFS with a current-arc pointer; O(E sqrt(V)).
+        static Matching hopcroftKarp(const CompactGraph &graph, const Bipartition &parts);
+
+        // Maximum weight matching over positive weights with the O(V^3) potential-based Hungarian
+        // algorithm; the smaller side is assigned into the larger one, with missing entries worth 0.
+        // side is indexed like the matrix, and the result fills mate and pairs only.
+        static Matching hungarian(const AdjacencyMatrix &matrix, const std::vector<char> &side, int invalid_value);
+    };
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef MIN_CUT_ENGINE_H
+#define MIN_CUT_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct GlobalCut {
+        long long weight = 0;
+        // side[v] is 1 for the nodes on one side of the cut, 0 for the rest
+        std::vector<char> side;
+        // false for a Monte Carlo answer, which is a cut but only probably a minimum one
+        bool exact = true;
+    };
+
+    // Global minimum cut of the underlying undirected graph: opposite arcs add up, negative weights
+    // count as 0 and self-loops are ignored. Disconnected graphs are answered with a zero cut at once.
+    // Both algorithms first contract every edge at least as heavy as the lightest weighted degree,
+    // which no lighter cut can cross, and only search what is left.
+    class MinCutEngine {
+
+    private:
+        MinCutEngine() = default;
+
+    public:
+        // minimumCut uses Stoer-Wagner when at most this many nodes are left after contraction
+        static const int stoerWagnerLimit = 2000;
+
+        // Maximum adjacency orderings on a lazy heap, merging the last two nodes after each phase;
+        // O(V (E + V) log V).
+        static GlobalCut stoerWagner(const CompactGraph &graph);
+
+        // Recursive contraction: each trial contracts to n / sqrt(2) + 1 nodes twice and recurses on
+        // both, brute-forcing graphs of six nodes or fewer. Contraction order comes from exponential
+        // keys -ln(U) / w, so heavy edges merge first. Trials run in parallel with seeds seed + i;
+        // trials <= 0 takes ceil(log2(n))^2.
+        static GlobalCut kargerStein(const CompactGraph &graph, int trials = 0, unsigned seed = 1);
+
+        static GlobalCut minimumCut(const CompactGraph &graph, int trials = 0);
+    };
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef REACHABILITY_ENGINE_H
+#define REACHABILITY_ENGINE_H
+
+#include "CompactGraph.h"
+#include "ComponentEngine.h"
+#include <vector>
+
+namespace GraphType {
+
+    // 2-hop labels over the condensation: u reaches v exactly when some hub is in both out-label of
+    // u's component and in-label of v's component. Hubs are stored by rank, so each label is sorted.
+    struct ReachabilityIndex {
+        std::vector<int> component;
+        std::vector<int> level;
+        std::vector<int> outOffsets, outHubs;
+        std::vector<int> inOffsets, inHubs;
+
+        bool reaches(int u, int v) const;
+
+        size_t labelSize() const { return outHubs.size() + inHubs.size(); }
+    };
+
+    class ReachabilityEngine {
+
+    private:
+        ReachabilityEngine() = default;
+
+    public:
+        // Pruned landmark labelling: hubs taken by descending degree product, each running a forward
+        // and a backward BFS on the condensation that stops wherever earlier labels already answer.
+        static ReachabilityIndex build(const CompactGraph &graph, const ComponentLabels &components);
+
+        static ReachabilityIndex build(const CompactGraph &graph);
+
+        // Grows the smaller of a forward frontier from u and a backward frontier from v, stopping at
+        // the first node both have seen. For one-off queries where building an index does not pay.
+        static bool bidirectionalSearch(const CompactGraph &graph, int u, int v);
+    };
+}
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef SHORTEST_PATH_ENGINE_H
+#define SHORTEST_PATH_ENGINE_H
+
+#include "CompactGraph.h"
+#include <climits>
+#include <vector>
+
+namespace GraphType {
+
+    enum ShortestPathBackend {
+        BinaryHeap, DeltaStepping
+    };
+
+    struct ShortestPathTree {
+        std::vector<long long> dist;
+        std::vector<int> parent;
+
+        bool reached(int v) const { return dist[v] != LLONG_MAX; }
+    };
+
+    class ShortestPathEngine {
+
+    private:
+        ShortestPathEngine() = default;
+
+    public:
+        static ShortestPathTree dijkstra(const CompactGraph &graph, int source, int goal = -1);
+
+        // Meyer-Sanders delta-stepping. delta <= 0 picks maxWeight / average degree; light-edge
+        // requests of every bucket phase are generated in parallel and applied in one sweep.
+        static ShortestPathTree deltaStepping(const CompactGraph &graph, int source, long long delta = 0);
+
+        static ShortestPathTree run(const CompactGraph &graph, int source, ShortestPathBackend backend);
+    };
+}
+
+#endif
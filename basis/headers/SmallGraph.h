@@ -0,0 +1,197 @@
+#ifndef SMALL_GRAPH_H
+#define SMALL_GRAPH_H
+
+#include "CompactGraph.h"
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace GraphType {
+
+    // Adjacency matrix of at most N nodes held as one std::bitset<N> per row, for kernels that work on
+    // whole neighbourhoods at once. Node ids match the CompactGraph it was built from.
+    template<std::size_t N>
+    class SmallGraph {
+
+    public:
+        typedef std::bitset<N> Row;
+
+    private:
+        int _n;
+        bool _directed;
+        std::vector<Row> _out;
+        std::vector<Row> _in;
+        std::vector<Row> _both;
+
+        struct CliqueSearch {
+            Row clique, best;
+            std::chrono::steady_clock::time_point deadline;
+            long long expanded = 0;
+            bool stopped = false;
+        };
+
+        void _expand(CliqueSearch &search, Row candidates) const {
+            if (search.stopped) return;
+            if ((++search.expanded & 1023) == 0 && std::chrono::steady_clock::now() > search.deadline) {
+                search.stopped = true;
+                return;
+            }
+            std::vector<int> order, bound;
+            colorClasses(candidates, order, bound);
+            for (int i = (int) order.size() - 1; i >= 0 && !search.stopped; i--) {
+                if (search.clique.count() + bound[i] <= search.best.count()) return;
+                int v = order[i];
+                search.clique.set(v);
+                Row next = candidates & neighbours(v);
+                if (next.none()) {
+                    if (search.clique.count() > search.best.count()) search.best = search.clique;
+                } else
+                    _expand(search, next);
+                search.clique.reset(v);
+                candidates.reset(v);
+            }
+        }
+
+    public:
+        static const std::size_t capacity = N;
+
+        SmallGraph(int node_num, bool directed) :
+                _n(node_num), _directed(directed), _out(node_num), _in(node_num), _both(node_num) {}
+
+        explicit SmallGraph(const CompactGraph &graph) : SmallGraph(graph.countNodes(), graph.isDirected()) {
+            for (auto &edge: graph.edges())
+                setEdge(edge.u, edge.v);
+        }
+
+        static bool fits(const CompactGraph &graph) { return (std::size_t) graph.countNodes() <= N; }
+
+        static int first(const Row &row) {
+#if defined(__GLIBCXX__)
+            return (int) row._Find_first();
+#else
+            for (std::size_t i = 0; i < N; i++)
+                if (row[i]) return (int) i;
+            return (int) N;
+#endif
+        }
+
+        static int next(const Row &row, int after) {
+#if defined(__GLIBCXX__)
+            return (int) row._Find_next(after);
+#else
+            for (std::size_t i = after + 1; i < N; i++)
+                if (row[i]) return (int) i;
+            return (int) N;
+#endif
+        }
+
+        int countNodes() const { return this->_n; }
+
+        bool isDirected() const { return this->_directed; }
+
+        void setEdge(int u, int v) {
+            _out[u].set(v);
+            _in[v].set(u);
+            if (u != v) {
+                _both[u].set(v);
+                _both[v].set(u);
+            }
+            if (!_directed) {
+                _out[v].set(u);
+                _in[u].set(v);
+            }
+        }
+
+        bool hasEdge(int u, int v) const { return _out[u][v]; }
+
+        const Row &out(int v) const { return _out[v]; }
+
+        const Row &in(int v) const { return _in[v]; }
+
+        // neighbours of v ignoring direction and self-loops
+        const Row &neighbours(int v) const { return _both[v]; }
+
+        Row nodes() const {
+            Row row;
+            for (int v = 0; v < _n; v++)
+                row.set(v);
+            return row;
+        }
+
+        Row reachable(int source, bool reversed = false) const {
+            Row visited, frontier;
+            frontier.set(source);
+            while (frontier.any()) {
+                visited |= frontier;
+                Row reached;
+                for (int v = first(frontier); v < (int) N; v = next(frontier, v))
+                    reached |= reversed ? _in[v] : _out[v];
+                frontier = reached & ~visited;
+            }
+            return visited;
+        }
+
+        // Warshall with whole-row ORs; row u holds v when a non-empty path u -> v exists
+        std::vector<Row> transitiveClosure() const {
+            std::vector<Row> reach(_out);
+            for (int k = 0; k < _n; k++)
+                for (int u = 0; u < _n; u++)
+                    if (reach[u][k])
+                        reach[u] |= reach[k];
+            return reach;
+        }
+
+        // Splits candidates into greedy independent sets; order lists the nodes class by class and
+        // bound[i] is the class number of order[i], counted from 1.
+        void colorClasses(Row candidates, std::vector<int> &order, std::vector<int> &bound) const {
+            for (int color = 1; candidates.any(); color++) {
+                Row open = candidates;
+                while (open.any()) {
+                    int v = first(open);
+                    open &= ~neighbours(v);
+                    open.reset(v);
+                    candidates.reset(v);
+                    order.push_back(v);
+                    bound.push_back(color);
+                }
+            }
+        }
+
+        std::vector<int> coloring() const {
+            std::vector<int> order, bound, color(_n, -1);
+            colorClasses(nodes(), order, bound);
+            for (std::size_t i = 0; i < order.size(); i++)
+                color[order[i]] = bound[i] - 1;
+            return color;
+        }
+
+        // Tomita-style branch and bound, pruning with the greedy colour classes of the candidates.
+        // complete is cleared when the deadline cut the search short and best is only the largest found.
+        Row maximumClique(std::chrono::steady_clock::time_point deadline, bool *complete = nullptr) const {
+            CliqueSearch search;
+            search.deadline = deadline;
+            if (_n > 0)
+                _expand(search, nodes());
+            if (complete)
+                *complete = !search.stopped;
+            return search.best;
+        }
+    };
+
+    // Calls fn(small) with the narrowest SmallGraph that holds the graph; false when none does.
+    template<class Fn>
+    bool withSmallGraph(const CompactGraph &graph, Fn fn) {
+        if (SmallGraph<64>::fits(graph))
+            fn(SmallGraph<64>(graph));
+        else if (SmallGraph<128>::fits(graph))
+            fn(SmallGraph<128>(graph));
+        else if (SmallGraph<256>::fits(graph))
+            fn(SmallGraph<256>(graph));
+        else
+            return false;
+        return true;
+    }
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef SPANNING_TREE_ENGINE_H
+#define SPANNING_TREE_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct SpanningForest {
+        std::vector<int> edges;
+        long long cost = 0;
+        int components = 0;
+
+        bool isTree() const { return components <= 1; }
+    };
+
+    // Edges are treated as undirected; a forest holds ids into CompactGraph::edges(), and components
+    // counts the connected components of the whole graph. Kruskal and Boruvka forests span every
+    // component with countNodes() - components edges; Prim's spans only the source's component.
+    class SpanningTreeEngine {
+
+    private:
+        SpanningTreeEngine() = default;
+
+    public:
+        static SpanningForest kruskal(const CompactGraph &graph);
+
+        static SpanningForest boruvka(const CompactGraph &graph);
+
+        static SpanningForest prim(const CompactGraph &graph, int source);
+
+        static SpanningForest minimumSpanningForest(const CompactGraph &graph);
+    };
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef TOPOLOGICAL_ENGINE_H
+#define TOPOLOGICAL_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct TopologicalOrder {
+        std::vector<int> order;
+        std::vector<int> level;
+        std::vector<std::vector<int>> levels;
+        std::vector<int> cycle;
+
+        bool isAcyclic() const { return cycle.empty(); }
+    };
+
+    class TopologicalEngine {
+
+    private:
+        TopologicalEngine() = default;
+
+    public:
+        // Level-synchronous Kahn: each frontier is an antichain whose nodes depend only on earlier
+        // levels, and wide frontiers are released in parallel. order is the levels concatenated.
+        // If some nodes are never released, cycle holds one directed cycle among them, first
+        // node repeated at the end.
+        static TopologicalOrder sort(const CompactGraph &graph);
+    };
+}
+
+#endif
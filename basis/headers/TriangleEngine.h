@@ -0,0 +1,39 @@
+#ifndef TRIANGLE_ENGINE_H
+#define TRIANGLE_ENGINE_H
+
+#include "CompactGraph.h"
+#include <vector>
+
+namespace GraphType {
+
+    struct TriangleCount {
+        long long triangles = 0;
+        // triangles through each node
+        std::vector<long long> local;
+        // distinct neighbours of each node, ignoring direction and self-loops
+        std::vector<int> degree;
+        // local clustering coefficient, 0 for nodes with fewer than two neighbours
+        std::vector<double> clustering;
+        // 3 * triangles / connected triples
+        double transitivity = 0;
+        // mean of the local coefficients over all nodes
+        double averageClustering = 0;
+    };
+
+    // Triangles of the underlying simple undirected graph: directions are dropped, reciprocal arcs
+    // merge into one edge and self-loops are ignored.
+    class TriangleEngine {
+
+    private:
+        TriangleEngine() = default;
+
+    public:
+        // Ranks nodes by degree and keeps every edge only from its lower to its higher ranked end, so
+        // each row holds at most sqrt(2E) entries and each triangle is found once, from its lowest
+        // ranked corner, by intersecting two sorted rows. Rows are processed in parallel; the
+        // intersection is a branch-free merge, or a galloping search when one row is much longer.
+        static TriangleCount count(const CompactGraph &graph);
+    };
+}
+
+#endif
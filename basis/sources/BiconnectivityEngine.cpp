@@ -0,0 +1,90 @@
+#include "basis/headers/BiconnectivityEngine.h"
+#include <algorithm>
+
+using namespace GraphType;
+
+namespace {
+    struct Frame {
+        int v;
+        int parentEdge;
+        int cursor;
+    };
+}
+
+Biconnectivity BiconnectivityEngine::analyze(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    Biconnectivity result;
+    std::vector<int> disc(n, -1), low(n, 0), children(n, 0);
+    std::vector<bool> articulation(n, false);
+    std::vector<int> edgeStack;
+    std::vector<Frame> frames;
+    int time = 0;
+
+    // a directed graph is walked through both its out- and in-arcs so every edge is seen from each end
+    auto degree = [&](int v) {
+        return graph.outDegree(v) + (graph.isDirected() ? graph.inDegree(v) : 0);
+    };
+    auto neighbour = [&](int v, int i, int &edge_id) {
+        if (i < graph.outDegree(v)) {
+            edge_id = graph.arcEdge(graph.outBegin(v) + i);
+            return graph.target(graph.outBegin(v) + i);
+        }
+        edge_id = graph.inArcEdge(graph.inBegin(v) + i - graph.outDegree(v));
+        return graph.source(graph.inBegin(v) + i - graph.outDegree(v));
+    };
+    auto closeBlock = [&](int edge_id) {
+        std::vector<int> block;
+        int top;
+        do {
+            top = edgeStack.back();
+            edgeStack.pop_back();
+            block.push_back(top);
+        } while (top != edge_id);
+        result.blocks.push_back(block);
+    };
+
+    for (int root = 0; root < n; root++) {
+        if (disc[root] != -1) continue;
+        disc[root] = low[root] = time++;
+        frames.push_back({root, -1, 0});
+        while (!frames.empty()) {
+            auto &frame = frames.back();
+            int v = frame.v;
+            if (frame.cursor < degree(v)) {
+                int edge_id;
+                int w = neighbour(v, frame.cursor++, edge_id);
+                if (edge_id == frame.parentEdge) continue;
+                if (disc[w] == -1) {
+                    children[v]++;
+                    edgeStack.push_back(edge_id);
+                    disc[w] = low[w] = time++;
+                    frames.push_back({w, edge_id, 0});
+                } else if (disc[w] < disc[v]) {
+                    edgeStack.push_back(edge_id);
+                    low[v] = std::min(low[v], disc[w]);
+                }
+                continue;
+            }
+            int tree_edge = frame.parentEdge;
+            frames.pop_back();
+            if (frames.empty()) {
+                if (children[v] > 1)
+                    articulation[v] = true;
+                continue;
+            }
+            int u = frames.back().v;
+            low[u] = std::min(low[u], low[v]);
+            if (low[v] > disc[u])
+                result.bridges.push_back(tree_edge);
+            if (low[v] >= disc[u]) {
+                if (frames.size() > 1)
+                    articulation[u] = true;
+                closeBlock(tree_edge);
+            }
+        }
+    }
+    for (int v = 0; v < n; v++)
+        if (articulation[v])
+            result.articulationNodes.push_back(v);
+    return result;
+}
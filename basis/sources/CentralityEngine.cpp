@@ -0,0 +1,330 @@
+#include "basis/headers/CentralityEngine.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+
+using namespace GraphType;
+
+namespace {
+
+    // In-rows packed for the kernels: from[a] is the source of in-arc a and share[a] its weight
+    struct PullRows {
+        // arcs plus nodes per block at the least; smaller graphs are one block and run inline
+        static const int grain = 16384;
+
+        int n;
+        std::vector<int> offsets, from;
+        std::vector<double> share;
+        // node ranges of about equal arc count, several per thread for dynamic balancing
+        std::vector<int> blocks;
+
+        explicit PullRows(const CompactGraph &graph) : n(graph.countNodes()), offsets(n + 1),
+                                                        from(graph.countArcs()) {
+            for (int v = 0; v < n; v++)
+                offsets[v] = graph.inBegin(v);
+            offsets[n] = graph.countArcs();
+            for (int a = 0; a < offsets[n]; a++)
+                from[a] = graph.source(a);
+            if (graph.isWeighted()) {
+                share.resize(offsets[n]);
+                for (int a = 0; a < offsets[n]; a++)
+                    share[a] = std::max(graph.inWeight(a), 0);
+            }
+            long long total = (long long) offsets[n] + n;
+            long long count = std::min<long long>(total / grain, std::min(n, Parallel::threadCount() * 8));
+            count = std::max(1LL, count);
+            blocks.push_back(0);
+            for (int b = 1; b < count; b++) {
+                long long goal = total * b / count;
+                // the first node whose arcs plus index reach the goal
+                int lo = blocks.back(), hi = n;
+                while (lo < hi) {
+                    int mid = (lo + hi) / 2;
+                    if ((long long) offsets[mid] + mid < goal) lo = mid + 1;
+                    else hi = mid;
+                }
+                if (lo > blocks.back() && lo < n) blocks.push_back(lo);
+            }
+            blocks.push_back(n);
+        }
+
+        int countBlocks() const { return (int) blocks.size() - 1; }
+
+        // Sum of x over the in-row of v, weighted when share is present. Four independent
+        // accumulators break the add chain so the gathers overlap.
+        double pull(int v, const double *x) const {
+            int a = offsets[v], end = offsets[v + 1];
+            double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+            if (share.empty()) {
+                for (; a + 4 <= end; a += 4) {
+                    s0 += x[from[a]];
+                    s1 += x[from[a + 1]];
+                    s2 += x[from[a + 2]];
+                    s3 += x[from[a + 3]];
+                }
+                for (; a < end; a++)
+                    s0 += x[from[a]];
+            } else {
+                for (; a + 4 <= end; a += 4) {
+                    s0 += share[a] * x[from[a]];
+                    s1 += share[a + 1] * x[from[a + 1]];
+                    s2 += share[a + 2] * x[from[a + 2]];
+                    s3 += share[a + 3] * x[from[a + 3]];
+                }
+                for (; a < end; a++)
+                    s0 += share[a] * x[from[a]];
+            }
+            return (s0 + s1) + (s2 + s3);
+        }
+    };
+
+    // Kahn's algorithm: whether repeatedly removing nodes without in-arcs empties the graph
+    bool acyclic(const CompactGraph &graph) {
+        int n = graph.countNodes();
+        std::vector<int> degree(n), ready;
+        for (int v = 0; v < n; v++) {
+            degree[v] = graph.inEnd(v) - graph.inBegin(v);
+            if (degree[v] == 0) ready.push_back(v);
+        }
+        for (size_t i = 0; i < ready.size(); i++)
+            for (int a = graph.outBegin(ready[i]); a < graph.outEnd(ready[i]); a++)
+                if (--degree[graph.target(a)] == 0)
+                    ready.push_back(graph.target(a));
+        return (int) ready.size() == n;
+    }
+
+    // Per-thread state of Brandes' algorithm; node and edge hold the thread's running totals
+    struct BrandesWorker {
+        std::vector<long long> dist;
+        std::vector<double> sigma, delta, node, edge;
+        std::vector<int> order;
+        std::priority_queue<std::pair<long long, int>, std::vector<std::pair<long long, int>>,
+                std::greater<std::pair<long long, int>>> heap;
+
+        BrandesWorker(int n, int m) : dist(n, -1), sigma(n, 0), delta(n, 0), node(n, 0), edge(m, 0) {
+            order.reserve(n);
+        }
+
+        static long long length(int weight, bool weighted) {
+            return weighted ? std::max(weight, 1) : 1;
+        }
+
+        // fills order with the nodes reached from source by non-decreasing distance
+        void search(const CompactGraph &graph, int source) {
+            order.clear();
+            dist[source] = 0;
+            sigma[source] = 1;
+            if (!graph.isWeighted()) {
+                order.push_back(source);
+                for (size_t i = 0; i < order.size(); i++) {
+                    int v = order[i];
+                    for (int a = graph.outBegin(v); a < graph.outEnd(v); a++) {
+                        int w = graph.target(a);
+                        if (dist[w] == -1) {
+                            dist[w] = dist[v] + 1;
+                            order.push_back(w);
+                        }
+                        if (dist[w] == dist[v] + 1)
+                            sigma[w] += sigma[v];
+                    }
+                }
+                return;
+            }
+            heap.push({0, source});
+            while (!heap.empty()) {
+                auto top = heap.top();
+                heap.pop();
+                int v = top.second;
+                // stale entry of a node that has since been reached by a shorter path
+                if (top.first != dist[v]) continue;
+                order.push_back(v);
+                for (int a = graph.outBegin(v); a < graph.outEnd(v); a++) {
+                    int w = graph.target(a);
+                    long long next = dist[v] + length(graph.weight(a), true);
+                    if (dist[w] == -1 || next < dist[w]) {
+                        dist[w] = next;
+                        sigma[w] = 0;
+                        heap.push({next, w});
+                    }
+                    if (next == dist[w])
+                        sigma[w] += sigma[v];
+                }
+            }
+        }
+
+        void accumulate(const CompactGraph &graph, int source, double scale) {
+            search(graph, source);
+            for (size_t i = order.size(); i-- > 1;) {
+                int w = order[i];
+                double coefficient = (1 + delta[w]) / sigma[w];
+                for (int a = graph.inBegin(w); a < graph.inEnd(w); a++) {
+                    int v = graph.source(a);
+                    if (dist[v] != -1 && dist[v] + length(graph.inWeight(a), graph.isWeighted()) == dist[w] &&
+                        v != w) {
+                        double share = sigma[v] * coefficient;
+                        delta[v] += share;
+                        edge[graph.inArcEdge(a)] += share * scale;
+                    }
+                }
+                node[w] += delta[w] * scale;
+            }
+            for (int v: order) {
+                dist[v] = -1;
+                sigma[v] = 0;
+                delta[v] = 0;
+            }
+        }
+    };
+
+    // adds up per-block partial sums in block order, so results do not depend on thread timing
+    double total(const std::vector<double> &partial) {
+        double sum = 0;
+        for (double value: partial)
+            sum += value;
+        return sum;
+    }
+}
+
+Centrality CentralityEngine::pageRank(const CompactGraph &graph, double damping, double tolerance,
+                                      int max_iterations) {
+    Centrality result;
+    int n = graph.countNodes();
+    if (n == 0) {
+        result.converged = true;
+        return result;
+    }
+    PullRows rows(graph);
+
+    // contrib[u] is the score u sends along each unit of out-weight; dangling nodes send nothing
+    std::vector<double> out_weight(n, 0), inverse(n, 0);
+    for (int u = 0; u < n; u++)
+        for (int a = graph.outBegin(u); a < graph.outEnd(u); a++)
+            out_weight[u] += graph.isWeighted() ? std::max(graph.weight(a), 0) : 1;
+    for (int u = 0; u < n; u++)
+        if (out_weight[u] > 0)
+            inverse[u] = 1.0 / out_weight[u];
+
+    std::vector<double> rank(n, 1.0 / n), next(n), contrib(n), next_contrib(n);
+    double dangling = 0;
+    for (int u = 0; u < n; u++) {
+        contrib[u] = rank[u] * inverse[u];
+        if (inverse[u] == 0) dangling += rank[u];
+    }
+
+    std::vector<double> change(rows.countBlocks()), lost(rows.countBlocks());
+    while (result.iterations < max_iterations) {
+        result.iterations++;
+        double base = (1 - damping) / n + damping * dangling / n;
+        // one pass computes the new scores and the contributions the next iteration pulls
+        Parallel::forDynamic(rows.countBlocks(), [&](int, int b) {
+            double delta = 0, sink = 0;
+            for (int v = rows.blocks[b]; v < rows.blocks[b + 1]; v++) {
+                double value = base + damping * rows.pull(v, contrib.data());
+                delta += std::fabs(value - rank[v]);
+                next[v] = value;
+                next_contrib[v] = value * inverse[v];
+                if (inverse[v] == 0) sink += value;
+            }
+            change[b] = delta;
+            lost[b] = sink;
+        });
+        rank.swap(next);
+        contrib.swap(next_contrib);
+        dangling = total(lost);
+        if (total(change) < tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+    result.score.swap(rank);
+    return result;
+}
+
+Centrality CentralityEngine::eigenvector(const CompactGraph &graph, double tolerance, int max_iterations) {
+    Centrality result;
+    int n = graph.countNodes();
+    if (n == 0) {
+        result.converged = true;
+        return result;
+    }
+    // every power of an acyclic adjacency ends at zero, so there is no positive eigenvalue to find
+    if (acyclic(graph)) {
+        result.score.assign(n, 0);
+        result.converged = true;
+        return result;
+    }
+    PullRows rows(graph);
+    std::vector<double> x(n, 1.0 / std::sqrt((double) n)), next(n);
+    std::vector<double> squares(rows.countBlocks()), change(rows.countBlocks());
+
+    while (result.iterations < max_iterations) {
+        result.iterations++;
+        Parallel::forDynamic(rows.countBlocks(), [&](int, int b) {
+            double sum = 0;
+            for (int v = rows.blocks[b]; v < rows.blocks[b + 1]; v++) {
+                next[v] = x[v] + rows.pull(v, x.data());
+                sum += next[v] * next[v];
+            }
+            squares[b] = sum;
+        });
+        double norm = std::sqrt(total(squares));
+        double scale = norm > 0 ? 1 / norm : 0;
+        Parallel::forDynamic(rows.countBlocks(), [&](int, int b) {
+            double delta = 0;
+            for (int v = rows.blocks[b]; v < rows.blocks[b + 1]; v++) {
+                next[v] *= scale;
+                delta += std::fabs(next[v] - x[v]);
+            }
+            change[b] = delta;
+        });
+        x.swap(next);
+        if (total(change) < tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+    result.score.swap(x);
+    return result;
+}
+
+Betweenness CentralityEngine::betweenness(const CompactGraph &graph, int samples, unsigned seed) {
+    Betweenness result;
+    int n = graph.countNodes(), m = graph.countEdges();
+    result.node.assign(n, 0);
+    result.edge.assign(m, 0);
+    std::vector<int> sources(n);
+    for (int v = 0; v < n; v++)
+        sources[v] = v;
+    if (samples > 0 && samples < n) {
+        std::mt19937 rng(seed);
+        for (int i = 0; i < samples; i++)
+            std::swap(sources[i], sources[i + rng() % (n - i)]);
+        sources.resize(samples);
+        result.exact = false;
+    }
+    result.sources = (int) sources.size();
+    if (sources.empty()) return result;
+    // both directions of every undirected pair are counted, hence the extra half
+    double scale = (double) n / sources.size() * (graph.isDirected() ? 1 : 0.5);
+
+    int threads = std::min(Parallel::threadCount(), (int) sources.size());
+    std::vector<std::unique_ptr<BrandesWorker>> workers(threads);
+    Parallel::forDynamic((int) sources.size(), [&](int tid, int i) {
+        if (!workers[tid])
+            workers[tid].reset(new BrandesWorker(n, m));
+        workers[tid]->accumulate(graph, sources[i], scale);
+    });
+    for (auto &worker: workers) {
+        if (!worker) continue;
+        for (int v = 0; v < n; v++)
+            result.node[v] += worker->node[v];
+        for (int e = 0; e < m; e++)
+            result.edge[e] += worker->edge[e];
+    }
+    return result;
+}
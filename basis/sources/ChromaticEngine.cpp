@@ -0,0 +1,194 @@
+#include "basis/headers/ChromaticEngine.h"
+#include "basis/headers/SmallGraph.h"
+#include "utils/bits.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace GraphType;
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    std::uint64_t bit(int v) {
+        return 1ULL << v;
+    }
+
+    std::vector<std::uint64_t> masks(const SmallGraph<ChromaticEngine::exactLimit> &small) {
+        std::vector<std::uint64_t> adjacency(small.countNodes());
+        for (int v = 0; v < small.countNodes(); v++)
+            adjacency[v] = small.neighbours(v).to_ullong();
+        return adjacency;
+    }
+
+    class ColoringSearch {
+    public:
+        ColoringSearch(const std::vector<std::uint64_t> &adjacency, const Coloring &initial, int lower_bound,
+                       Clock::time_point deadline) :
+                best(initial), _adjacency(adjacency), _n((int) adjacency.size()), _lowerBound(lower_bound),
+                _deadline(deadline), _color(adjacency.size(), -1), _forbidden(adjacency.size(), 0),
+                _counts(adjacency.size() * adjacency.size(), 0) {}
+
+        void run() {
+            search(_n ? (_n == 64 ? ~0ULL : bit(_n) - 1) : 0, 0);
+        }
+
+        Coloring best;
+        bool timedOut = false;
+
+    private:
+        const std::vector<std::uint64_t> &_adjacency;
+        int _n;
+        int _lowerBound;
+        Clock::time_point _deadline;
+        std::vector<int> _color;
+        std::vector<std::uint64_t> _forbidden;
+        std::vector<int> _counts;
+        long long _expanded = 0;
+
+        bool done() const {
+            return timedOut || best.count <= _lowerBound;
+        }
+
+        void assign(int v, int c, std::uint64_t uncolored) {
+            _color[v] = c;
+            for (std::uint64_t rest = _adjacency[v] & uncolored; rest; rest &= rest - 1) {
+                int w = Bits::lowest(rest);
+                if (_counts[w * _n + c]++ == 0)
+                    _forbidden[w] |= bit(c);
+            }
+        }
+
+        void unassign(int v, int c, std::uint64_t uncolored) {
+            _color[v] = -1;
+            for (std::uint64_t rest = _adjacency[v] & uncolored; rest; rest &= rest - 1) {
+                int w = Bits::lowest(rest);
+                if (--_counts[w * _n + c] == 0)
+                    _forbidden[w] &= ~bit(c);
+            }
+        }
+
+        void search(std::uint64_t uncolored, int used) {
+            if (done()) return;
+            if ((++_expanded & 1023) == 0 && Clock::now() > _deadline) {
+                timedOut = true;
+                return;
+            }
+            if (!uncolored) {
+                best.color = _color;
+                best.count = used;
+                return;
+            }
+            int v = -1, saturation = -1, degree = -1;
+            for (std::uint64_t rest = uncolored; rest; rest &= rest - 1) {
+                int w = Bits::lowest(rest);
+                int s = Bits::count(_forbidden[w]), d = Bits::count(_adjacency[w] & uncolored);
+                if (s > saturation || (s == saturation && d > degree)) {
+                    v = w;
+                    saturation = s;
+                    degree = d;
+                }
+            }
+            uncolored &= ~bit(v);
+            // a fresh colour is only worth trying while it still beats the best colouring
+            for (int c = 0; c <= used && std::max(used, c + 1) < best.count && !done(); c++) {
+                if (_forbidden[v] >> c & 1) continue;
+                assign(v, c, uncolored);
+                search(uncolored, std::max(used, c + 1));
+                unassign(v, c, uncolored);
+            }
+        }
+    };
+
+    const std::uint64_t primes[] = {4294967291ULL, 4294967279ULL};
+}
+
+std::vector<std::uint64_t> ChromaticEngine::adjacencyMasks(const CompactGraph &graph) {
+    return masks(SmallGraph<exactLimit>(graph));
+}
+
+int ChromaticEngine::inclusionExclusion(const std::vector<std::uint64_t> &adjacency, int lower, int upper) {
+    int n = (int) adjacency.size();
+    if (lower >= upper || n > inclusionExclusionLimit) return upper;
+    // independent[S] counts the independent subsets of S, split on the lowest node of S
+    std::vector<std::uint32_t> independent((size_t) 1 << n);
+    independent[0] = 1;
+    for (std::uint32_t set = 1; set < (1u << n); set++) {
+        int v = Bits::lowest(set);
+        std::uint32_t rest = set & ~(std::uint32_t) bit(v);
+        independent[set] = independent[rest] + independent[rest & ~(std::uint32_t) adjacency[v]];
+    }
+    // sum over S of (-1)^(n - |S|) * independent[S]^k counts the k-tuples of independent sets covering all nodes
+    std::vector<std::uint64_t> sums(2 * upper, 0);
+    for (std::uint32_t set = 0; set < (1u << n); set++) {
+        bool negative = (n - Bits::count(set)) % 2 == 1;
+        for (int p = 0; p < 2; p++) {
+            std::uint64_t base = independent[set] % primes[p], power = 1;
+            for (int k = 1; k < upper; k++) {
+                power = power * base % primes[p];
+                auto &sum = sums[p * upper + k];
+                sum = (sum + (negative ? primes[p] - power : power)) % primes[p];
+            }
+        }
+    }
+    for (int k = std::max(lower, 1); k < upper; k++)
+        if (sums[k] != 0 || sums[upper + k] != 0)
+            return k;
+    return upper;
+}
+
+ChromaticResult ChromaticEngine::branchAndBound(const std::vector<std::uint64_t> &adjacency, const Coloring &initial,
+                                                int lower_bound, int time_limit_ms) {
+    ColoringSearch search(adjacency, initial, lower_bound,
+                          Clock::now() + std::chrono::milliseconds(time_limit_ms));
+    search.run();
+    ChromaticResult result;
+    result.coloring = search.best;
+    result.optimal = !search.timedOut;
+    result.lowerBound = result.optimal ? result.coloring.count : lower_bound;
+    return result;
+}
+
+ChromaticResult ChromaticEngine::solve(const CompactGraph &graph, int time_limit_ms) {
+    auto deadline = Clock::now() + std::chrono::milliseconds(time_limit_ms);
+    auto remaining = [&]() {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+        return (int) std::max<long long>(0, left);
+    };
+    ChromaticResult result;
+    result.coloring = ColoringEngine::dsatur(graph);
+    auto other = ColoringEngine::smallestLast(graph);
+    if (other.count < result.coloring.count)
+        result.coloring = other;
+    if (graph.countNodes() > exactLimit)
+        return result;
+
+    SmallGraph<exactLimit> small(graph);
+    auto classes = small.coloring();
+    int class_count = classes.empty() ? 0 : *std::max_element(classes.begin(), classes.end()) + 1;
+    if (class_count < result.coloring.count) {
+        result.coloring.color = classes;
+        result.coloring.count = class_count;
+    }
+    // any clique bounds the colour count from below, so one cut short by its deadline still counts
+    auto clique = small.maximumClique(Clock::now() + std::chrono::milliseconds(time_limit_ms / 4));
+    result.lowerBound = result.probableBound = (int) clique.count();
+    auto adjacency = masks(small);
+    if (result.lowerBound >= result.coloring.count) {
+        result.optimal = true;
+        return result;
+    }
+
+    if ((int) adjacency.size() <= inclusionExclusionLimit) {
+        result.probableBound = inclusionExclusion(adjacency, result.lowerBound, result.coloring.count);
+        // its non-zero count proves probableBound colours suffice, so the search may stop on reaching it
+        if (result.probableBound < result.coloring.count)
+            result.coloring = branchAndBound(adjacency, result.coloring, result.probableBound, remaining()).coloring;
+    }
+    // fewer colours are only ruled out by an exhaustive search down to the clique bound
+    auto searched = branchAndBound(adjacency, result.coloring, result.lowerBound, remaining());
+    result.coloring = searched.coloring;
+    result.optimal = searched.optimal;
+    if (result.optimal)
+        result.lowerBound = result.probableBound = result.coloring.count;
+    return result;
+}
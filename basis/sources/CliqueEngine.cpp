@@ -0,0 +1,360 @@
+#include "basis/headers/CliqueEngine.h"
+#include "basis/headers/ColoringEngine.h"
+#include "basis/headers/SmallGraph.h"
+#include "utils/bits.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+using namespace GraphType;
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+    typedef std::vector<std::uint64_t> Words;
+
+    std::vector<std::vector<int>> undirectedNeighbours(const CompactGraph &graph) {
+        std::vector<std::vector<int>> neighbours(graph.countNodes());
+        for (auto &edge: graph.edges()) {
+            if (edge.u == edge.v) continue;
+            neighbours[edge.u].push_back(edge.v);
+            neighbours[edge.v].push_back(edge.u);
+        }
+        for (auto &list: neighbours) {
+            std::sort(list.begin(), list.end());
+            list.erase(std::unique(list.begin(), list.end()), list.end());
+        }
+        return neighbours;
+    }
+
+    // repeatedly takes a node of minimum remaining degree among nodes and drops its neighbours
+    std::vector<int> greedyIndependentSet(const std::vector<std::vector<int>> &neighbours, const std::vector<int> &nodes,
+                                          const std::vector<bool> &alive) {
+        std::vector<int> degree(neighbours.size(), 0), chosen;
+        std::vector<bool> removed(alive.size(), false);
+        for (int v: nodes)
+            for (int w: neighbours[v])
+                degree[v] += alive[w];
+        while (true) {
+            int v = -1;
+            for (int w: nodes)
+                if (!removed[w] && (v == -1 || degree[w] < degree[v]))
+                    v = w;
+            if (v == -1) break;
+            chosen.push_back(v);
+            removed[v] = true;
+            for (int w: neighbours[v]) {
+                if (removed[w] || !alive[w]) continue;
+                removed[w] = true;
+                for (int x: neighbours[w])
+                    degree[x]--;
+            }
+        }
+        return chosen;
+    }
+
+    // A top-level branch: the fixed node, the candidates that may join it and a bound on the clique size
+    struct Branch {
+        int root;
+        std::vector<int> members;
+        int bound;
+    };
+
+    class SharedBest {
+    public:
+        SharedBest(Clock::time_point deadline) : _deadline(deadline) {}
+
+        int size() const { return _size.load(std::memory_order_relaxed); }
+
+        bool stopped() const { return _stop.load(std::memory_order_relaxed); }
+
+        bool expired() {
+            if (Clock::now() <= _deadline) return false;
+            _stop = true;
+            return true;
+        }
+
+        void offer(const std::vector<int> &nodes) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if ((int) nodes.size() <= _size) return;
+            _nodes = nodes;
+            _size = (int) nodes.size();
+        }
+
+        const std::vector<int> &nodes() const { return _nodes; }
+
+    private:
+        Clock::time_point _deadline;
+        std::atomic<int> _size{0};
+        std::atomic<bool> _stop{false};
+        std::mutex _mutex;
+        std::vector<int> _nodes;
+    };
+
+    // MCQ over a dense subgraph of k members, one row of k bits per member
+    class DenseSearch {
+    public:
+        DenseSearch(const Branch &branch, const Words &rows, int words, SharedBest &best) :
+                _branch(branch), _rows(rows), _words(words), _best(best) {}
+
+        void run() {
+            int k = (int) _branch.members.size();
+            Words all(_words, 0);
+            for (int i = 0; i < k; i++)
+                all[i / 64] |= 1ULL << (i % 64);
+            _clique.assign(1, _branch.root);
+            if (k == 0)
+                _best.offer(_clique);
+            else
+                expand(all);
+        }
+
+    private:
+        const Branch &_branch;
+        const Words &_rows;
+        int _words;
+        SharedBest &_best;
+        std::vector<int> _clique;
+        long long _expanded = 0;
+
+        static bool empty(const Words &set) {
+            for (auto word: set)
+                if (word) return false;
+            return true;
+        }
+
+        // A candidate adjacent to every other candidate but at most one can always be taken: a maximum
+        // clique without it must hold that one candidate, which it can replace.
+        void reduce(Words &candidates) {
+            for (bool changed = true; changed;) {
+                changed = false;
+                for (int w = 0; w < _words; w++) {
+                    for (std::uint64_t rest = candidates[w]; rest; rest &= rest - 1) {
+                        int v = w * 64 + Bits::lowest(rest);
+                        if (!(candidates[w] >> (v % 64) & 1)) continue;
+                        int missing = -1, other = -1;
+                        for (int x = 0; x < _words && missing < 2; x++) {
+                            std::uint64_t outside = candidates[x] & ~_rows[(size_t) v * _words + x];
+                            missing += Bits::count(outside);
+                            for (; outside; outside &= outside - 1)
+                                if (x * 64 + Bits::lowest(outside) != v)
+                                    other = x * 64 + Bits::lowest(outside);
+                        }
+                        if (missing > 1) continue;
+                        _clique.push_back(_branch.members[v]);
+                        candidates[w] &= ~(1ULL << (v % 64));
+                        if (missing == 1)
+                            candidates[other / 64] &= ~(1ULL << (other % 64));
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        void expand(Words candidates) {
+            if (_best.stopped()) return;
+            if ((++_expanded & 1023) == 0 && _best.expired()) return;
+            size_t base = _clique.size();
+            reduce(candidates);
+            std::vector<int> order, bound;
+            Words rest(candidates), open(_words);
+            for (int color = 1; !empty(rest); color++) {
+                open = rest;
+                for (int w = 0; w < _words; w++) {
+                    while (open[w]) {
+                        int v = w * 64 + Bits::lowest(open[w]);
+                        open[w] &= open[w] - 1;
+                        rest[w] &= ~(1ULL << (v % 64));
+                        for (int x = w; x < _words; x++)
+                            open[x] &= ~_rows[(size_t) v * _words + x];
+                        order.push_back(v);
+                        bound.push_back(color);
+                    }
+                }
+            }
+            if (order.empty())
+                _best.offer(_clique);
+            Words next(_words);
+            for (int i = (int) order.size() - 1; i >= 0; i--) {
+                if ((int) _clique.size() + bound[i] <= _best.size() || _best.stopped()) break;
+                int v = order[i];
+                _clique.push_back(_branch.members[v]);
+                for (int w = 0; w < _words; w++)
+                    next[w] = candidates[w] & _rows[(size_t) v * _words + w];
+                expand(next);
+                _clique.pop_back();
+                candidates[v / 64] &= ~(1ULL << (v % 64));
+            }
+            _clique.resize(base);
+        }
+    };
+
+    // Runs, in the order given, every branch whose bound still beats the best clique. complement
+    // selects whether rows hold the edges or the non-edges among the members.
+    CliqueResult searchBranches(const CompactGraph &graph, const std::vector<Branch> &branches,
+                                const std::vector<std::vector<int>> &neighbours, bool complement,
+                                const std::vector<int> &initial, int time_limit_ms) {
+        SharedBest best(Clock::now() + std::chrono::milliseconds(time_limit_ms));
+        best.offer(initial);
+        std::vector<std::vector<int>> local(Parallel::threadCount());
+        Parallel::forDynamic((int) branches.size(), [&](int tid, int i) {
+            const Branch &branch = branches[i];
+            int k = (int) branch.members.size();
+            if (branch.bound <= best.size() || best.stopped()) return;
+            auto &index = local[tid];
+            if (index.empty())
+                index.assign(graph.countNodes(), -1);
+            for (int j = 0; j < k; j++)
+                index[branch.members[j]] = j;
+            int words = (k + 63) / 64;
+            Words rows((size_t) k * words, 0);
+            for (int j = 0; j < k; j++) {
+                auto row = rows.begin() + (size_t) j * words;
+                if (complement) {
+                    for (int x = 0; x < k; x++)
+                        if (x != j) row[x / 64] |= 1ULL << (x % 64);
+                }
+                for (int w: neighbours[branch.members[j]]) {
+                    int x = index[w];
+                    if (x == -1) continue;
+                    if (complement)
+                        row[x / 64] &= ~(1ULL << (x % 64));
+                    else
+                        row[x / 64] |= 1ULL << (x % 64);
+                }
+            }
+            for (int member: branch.members)
+                index[member] = -1;
+            DenseSearch(branch, rows, words, best).run();
+        });
+        CliqueResult result;
+        result.nodes = best.nodes();
+        std::sort(result.nodes.begin(), result.nodes.end());
+        result.optimal = !best.stopped();
+        return result;
+    }
+}
+
+CliqueResult CliqueEngine::maximumClique(const CompactGraph &graph, int time_limit_ms) {
+    int n = graph.countNodes();
+    CliqueResult small_result;
+    if (withSmallGraph(graph, [&](const auto &small) {
+        auto clique = small.maximumClique(Clock::now() + std::chrono::milliseconds(time_limit_ms),
+                                          &small_result.optimal);
+        for (int v = small.first(clique); v < n; v = small.next(clique, v))
+            small_result.nodes.push_back(v);
+    }))
+        return small_result;
+
+    auto neighbours = undirectedNeighbours(graph);
+    // smallestLastOrder lists the last removed node first, so later in removal order means earlier here
+    auto order = ColoringEngine::smallestLastOrder(graph);
+    std::vector<int> position(n);
+    for (int i = 0; i < n; i++)
+        position[order[i]] = i;
+    std::vector<Branch> branches(n);
+    for (int v = 0; v < n; v++) {
+        branches[v].root = v;
+        for (int w: neighbours[v])
+            if (position[w] < position[v])
+                branches[v].members.push_back(w);
+        branches[v].bound = (int) branches[v].members.size() + 1;
+    }
+    std::sort(branches.begin(), branches.end(), [](const Branch &a, const Branch &b) {
+        return a.bound > b.bound;
+    });
+    return searchBranches(graph, branches, neighbours, false, std::vector<int>(), time_limit_ms);
+}
+
+CliqueResult CliqueEngine::maximumIndependentSet(const CompactGraph &graph, int time_limit_ms) {
+    int n = graph.countNodes();
+    CliqueResult result;
+    if (n > complementLimit) {
+        result.optimal = false;
+        return result;
+    }
+    auto deadline = Clock::now() + std::chrono::milliseconds(time_limit_ms);
+    auto neighbours = undirectedNeighbours(graph);
+
+    // a node with at most one remaining neighbour belongs to some maximum independent set
+    std::vector<bool> alive(n, true);
+    std::vector<int> degree(n), pending;
+    for (int v = 0; v < n; v++) {
+        degree[v] = (int) neighbours[v].size();
+        if (degree[v] <= 1) pending.push_back(v);
+    }
+    while (!pending.empty()) {
+        int v = pending.back();
+        pending.pop_back();
+        if (!alive[v] || degree[v] > 1) continue;
+        result.nodes.push_back(v);
+        alive[v] = false;
+        for (int w: neighbours[v]) {
+            if (!alive[w]) continue;
+            alive[w] = false;
+            for (int x: neighbours[w])
+                if (alive[x] && --degree[x] <= 1)
+                    pending.push_back(x);
+        }
+    }
+
+    // what is left splits into components that are solved one at a time on their complements
+    std::vector<int> component(n, -1);
+    std::vector<bool> adjacent(n, false);
+    for (int s = 0; s < n; s++) {
+        if (!alive[s] || component[s] != -1) continue;
+        std::vector<int> nodes(1, s);
+        component[s] = s;
+        for (size_t i = 0; i < nodes.size(); i++)
+            for (int w: neighbours[nodes[i]])
+                if (alive[w] && component[w] == -1) {
+                    component[w] = s;
+                    nodes.push_back(w);
+                }
+        // MCQ's initial colour sort on the complement: its colour classes are cliques of the graph,
+        // and a node can only join nodes from earlier classes or the earlier part of its own
+        std::vector<int> order, bound;
+        std::vector<bool> placed(n, false);
+        for (int color = 1; order.size() < nodes.size(); color++) {
+            std::vector<int> open;
+            for (int v: nodes)
+                if (!placed[v]) open.push_back(v);
+            while (!open.empty()) {
+                int v = open.front();
+                placed[v] = true;
+                order.push_back(v);
+                bound.push_back(color);
+                for (int w: neighbours[v])
+                    adjacent[w] = true;
+                open.erase(std::remove_if(open.begin(), open.end(), [&](int w) {
+                    return !adjacent[w] || placed[w];
+                }), open.end());
+                for (int w: neighbours[v])
+                    adjacent[w] = false;
+            }
+        }
+        // highest classes first, since their branches see the most candidates
+        std::vector<Branch> branches(order.size());
+        for (int i = (int) order.size() - 1; i >= 0; i--) {
+            auto &branch = branches[order.size() - 1 - i];
+            branch.root = order[i];
+            branch.bound = bound[i];
+            for (int w: neighbours[order[i]])
+                adjacent[w] = true;
+            for (int j = 0; j < i; j++)
+                if (!adjacent[order[j]])
+                    branch.members.push_back(order[j]);
+            for (int w: neighbours[order[i]])
+                adjacent[w] = false;
+        }
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+        auto found = searchBranches(graph, branches, neighbours, true, greedyIndependentSet(neighbours, nodes, alive),
+                                    (int) std::max<long long>(0, remaining));
+        result.nodes.insert(result.nodes.end(), found.nodes.begin(), found.nodes.end());
+        result.optimal = result.optimal && found.optimal;
+    }
+    std::sort(result.nodes.begin(), result.nodes.end());
+    return result;
+}
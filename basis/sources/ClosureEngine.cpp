@@ -0,0 +1,192 @@
+#include "basis/headers/ClosureEngine.h"
+#include "basis/headers/ComponentEngine.h"
+#include "basis/headers/SmallGraph.h"
+#include "utils/bits.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <utility>
+
+using namespace GraphType;
+
+namespace {
+
+    // groups of eight rows whose tables are built together before the rows of a are swept
+    const int tableBatch = 32;
+
+    void orInto(std::uint64_t *target, const std::uint64_t *source, int words) {
+        for (int w = 0; w < words; w++)
+            target[w] |= source[w];
+    }
+}
+
+long long BitMatrix::count() const {
+    long long total = 0;
+    for (auto word: _bits)
+        total += Bits::count(word);
+    return total;
+}
+
+BitMatrix ClosureEngine::adjacency(const CompactGraph &graph) {
+    BitMatrix matrix(graph.countNodes(), graph.countNodes());
+    for (int u = 0; u < graph.countNodes(); u++)
+        for (int arc = graph.outBegin(u); arc < graph.outEnd(u); arc++)
+            matrix.set(u, graph.target(arc));
+    return matrix;
+}
+
+BitMatrix ClosureEngine::multiply(const BitMatrix &a, const BitMatrix &b) {
+    BitMatrix product(a.rows(), b.cols());
+    int words = b.words(), groups = (b.rows() + 7) / 8;
+    std::vector<std::uint64_t> tables((size_t) tableBatch * 256 * words);
+    for (int first = 0; first < groups; first += tableBatch) {
+        int batch = std::min(tableBatch, groups - first);
+        Parallel::forBlocks(batch, [&](int, int begin, int end) {
+            for (int g = begin; g < end; g++) {
+                std::uint64_t *table = tables.data() + (size_t) g * 256 * words;
+                std::fill(table, table + words, 0);
+                for (int mask = 1; mask < 256; mask++) {
+                    std::uint64_t *entry = table + (size_t) mask * words;
+                    std::copy(table + (size_t) (mask & (mask - 1)) * words,
+                              table + (size_t) (mask & (mask - 1)) * words + words, entry);
+                    int r = 8 * (first + g) + Bits::lowest(mask);
+                    if (r < b.rows())
+                        orInto(entry, b.row(r), words);
+                }
+            }
+        }, 1);
+        Parallel::forBlocks(a.rows(), [&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                const std::uint64_t *source = a.row(i);
+                std::uint64_t *target = product.row(i);
+                for (int g = 0; g < batch; g++) {
+                    int bit = 8 * (first + g);
+                    int mask = (int) ((source[bit >> 6] >> (bit & 63)) & 0xff);
+                    if (mask)
+                        orInto(target, tables.data() + ((size_t) g * 256 + mask) * words, words);
+                }
+            }
+        }, 64);
+    }
+    return product;
+}
+
+BitMatrix ClosureEngine::squaring(const BitMatrix &adjacency) {
+    BitMatrix reach = adjacency;
+    while (true) {
+        BitMatrix square = multiply(reach, reach);
+        bool changed = false;
+        for (int r = 0; r < reach.rows(); r++) {
+            std::uint64_t *row = reach.row(r);
+            const std::uint64_t *extra = square.row(r);
+            for (int w = 0; w < reach.words(); w++) {
+                if (extra[w] & ~row[w]) {
+                    row[w] |= extra[w];
+                    changed = true;
+                }
+            }
+        }
+        if (!changed) return reach;
+    }
+}
+
+BitMatrix ClosureEngine::transitiveClosure(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    // a few hundred nodes close fastest by Warshall over bitset rows, without the condensation
+    BitMatrix small_closure(n, n);
+    if (withSmallGraph(graph, [&](const auto &small) {
+        auto rows = small.transitiveClosure();
+        for (int u = 0; u < n; u++)
+            for (int v = small.first(rows[u]); v < n; v = small.next(rows[u], v))
+                small_closure.set(u, v);
+    }))
+        return small_closure;
+
+    auto labels = ComponentEngine::stronglyConnected(graph);
+    auto &component = labels.component;
+    int count = labels.count;
+
+    std::vector<int> member_offsets(count + 1, 0), members(n);
+    for (int v = 0; v < n; v++)
+        member_offsets[component[v] + 1]++;
+    for (int c = 0; c < count; c++)
+        member_offsets[c + 1] += member_offsets[c];
+    std::vector<int> cursor(member_offsets.begin(), member_offsets.end() - 1);
+    for (int v = 0; v < n; v++)
+        members[cursor[component[v]]++] = v;
+
+    std::vector<char> cyclic(count, 0);
+    std::vector<std::pair<int, int>> arcs;
+    for (int c = 0; c < count; c++)
+        cyclic[c] = member_offsets[c + 1] - member_offsets[c] > 1;
+    for (auto &edge: graph.edges()) {
+        int a = component[edge.u], b = component[edge.v];
+        if (a != b)
+            arcs.emplace_back(a, b);
+        else if (edge.u == edge.v)
+            cyclic[a] = 1;
+    }
+    std::sort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    std::vector<int> arc_offsets(count + 1, 0);
+    for (auto &arc: arcs)
+        arc_offsets[arc.first + 1]++;
+    for (int c = 0; c < count; c++)
+        arc_offsets[c + 1] += arc_offsets[c];
+
+    // component ids are topological, so walking them backwards settles every successor first
+    std::vector<int> height(count, 0);
+    int max_height = 0;
+    for (int c = count - 1; c >= 0; c--) {
+        for (int i = arc_offsets[c]; i < arc_offsets[c + 1]; i++)
+            height[c] = std::max(height[c], height[arcs[i].second] + 1);
+        max_height = std::max(max_height, height[c]);
+    }
+
+    BitMatrix reach(count, count);
+    int rounds = 1;
+    while ((1 << rounds) <= max_height + 1)
+        rounds++;
+    // squaring costs about rounds * (count + 256) * count / 8 row ORs, the DAG sweep one per arc
+    if ((long long) rounds * (count + 256) * count / 8 < (long long) arcs.size()) {
+        BitMatrix dag(count, count);
+        for (auto &arc: arcs)
+            dag.set(arc.first, arc.second);
+        reach = squaring(dag);
+    } else {
+        std::vector<std::vector<int>> by_height(max_height + 1);
+        for (int c = 0; c < count; c++)
+            by_height[height[c]].push_back(c);
+        for (auto &level: by_height) {
+            Parallel::forBlocks((int) level.size(), [&](int, int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    int c = level[i];
+                    for (int a = arc_offsets[c]; a < arc_offsets[c + 1]; a++) {
+                        orInto(reach.row(c), reach.row(arcs[a].second), reach.words());
+                        reach.set(c, arcs[a].second);
+                    }
+                }
+            }, 64);
+        }
+    }
+    for (int c = 0; c < count; c++)
+        if (cyclic[c])
+            reach.set(c, c);
+
+    BitMatrix closure(n, n);
+    Parallel::forBlocks(count, [&](int, int begin, int end) {
+        for (int c = begin; c < end; c++) {
+            if (member_offsets[c] == member_offsets[c + 1]) continue;
+            std::uint64_t *first = closure.row(members[member_offsets[c]]);
+            const std::uint64_t *row = reach.row(c);
+            for (int w = 0; w < reach.words(); w++)
+                for (std::uint64_t bits = row[w]; bits; bits &= bits - 1) {
+                    int d = 64 * w + Bits::lowest(bits);
+                    for (int m = member_offsets[d]; m < member_offsets[d + 1]; m++)
+                        first[members[m] >> 6] |= std::uint64_t(1) << (members[m] & 63);
+                }
+            for (int m = member_offsets[c] + 1; m < member_offsets[c + 1]; m++)
+                std::copy(first, first + closure.words(), closure.row(members[m]));
+        }
+    }, 16);
+    return closure;
+}
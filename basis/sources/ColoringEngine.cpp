@@ -0,0 +1,232 @@
+#include "basis/headers/ColoringEngine.h"
+#include "utils/bits.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <queue>
+#include <tuple>
+
+using namespace GraphType;
+
+namespace {
+    template<class Fn>
+    void forNeighbours(const CompactGraph &graph, int v, Fn fn) {
+        for (int a = graph.outBegin(v); a < graph.outEnd(v); a++)
+            if (graph.target(a) != v)
+                fn(graph.target(a));
+        if (graph.isDirected())
+            for (int a = graph.inBegin(v); a < graph.inEnd(v); a++)
+                if (graph.source(a) != v)
+                    fn(graph.source(a));
+    }
+
+    int neighbourCount(const CompactGraph &graph, int v) {
+        int count = 0;
+        forNeighbours(graph, v, [&](int) { count++; });
+        return count;
+    }
+
+    class ColorMask {
+    public:
+        bool test(int c) const {
+            return c / 64 < (int) _words.size() && (_words[c / 64] >> (c % 64) & 1);
+        }
+
+        void set(int c) {
+            if (c / 64 >= (int) _words.size())
+                _words.resize(c / 64 + 1, 0);
+            _words[c / 64] |= 1ULL << (c % 64);
+        }
+
+        void reset(int c) {
+            _words[c / 64] &= ~(1ULL << (c % 64));
+        }
+
+        int firstFree() const {
+            for (int i = 0; i < (int) _words.size(); i++)
+                if (~_words[i])
+                    return i * 64 + Bits::lowest(~_words[i]);
+            return (int) _words.size() * 64;
+        }
+
+    private:
+        std::vector<std::uint64_t> _words;
+    };
+
+    // marks the neighbour colours, picks the first free one and clears only the bits it set
+    int firstFit(const CompactGraph &graph, int v, const std::vector<int> &color, ColorMask &mask) {
+        forNeighbours(graph, v, [&](int w) {
+            if (color[w] != -1) mask.set(color[w]);
+        });
+        int c = mask.firstFree();
+        forNeighbours(graph, v, [&](int w) {
+            if (color[w] != -1) mask.reset(color[w]);
+        });
+        return c;
+    }
+
+    void countColors(Coloring &coloring) {
+        coloring.count = 0;
+        for (int c: coloring.color)
+            coloring.count = std::max(coloring.count, c + 1);
+    }
+
+    std::uint64_t priority(int v) {
+        std::uint64_t x = (std::uint64_t) v + 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+}
+
+std::vector<int> ColoringEngine::smallestLastOrder(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    std::vector<int> degree(n), position(n), order(n);
+    int max_degree = 0;
+    for (int v = 0; v < n; v++) {
+        degree[v] = neighbourCount(graph, v);
+        max_degree = std::max(max_degree, degree[v]);
+    }
+    // bin[d] is the first slot of degree d in order, which stays sorted by current degree
+    std::vector<int> bin(max_degree + 2, 0);
+    for (int v = 0; v < n; v++)
+        bin[degree[v] + 1]++;
+    for (int d = 1; d <= max_degree + 1; d++)
+        bin[d] += bin[d - 1];
+    for (int v = 0; v < n; v++) {
+        position[v] = bin[degree[v]]++;
+        order[position[v]] = v;
+    }
+    for (int d = max_degree; d > 0; d--)
+        bin[d] = bin[d - 1];
+    bin[0] = 0;
+
+    for (int i = 0; i < n; i++) {
+        int v = order[i];
+        forNeighbours(graph, v, [&](int w) {
+            if (degree[w] <= degree[v]) return;
+            int first = bin[degree[w]], u = order[first];
+            if (u != w) {
+                std::swap(order[first], order[position[w]]);
+                position[u] = position[w];
+                position[w] = first;
+            }
+            bin[degree[w]]++;
+            degree[w]--;
+        });
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+Coloring ColoringEngine::greedy(const CompactGraph &graph, const std::vector<int> &order) {
+    Coloring coloring;
+    coloring.color.assign(graph.countNodes(), -1);
+    ColorMask mask;
+    for (int v: order)
+        coloring.color[v] = firstFit(graph, v, coloring.color, mask);
+    countColors(coloring);
+    return coloring;
+}
+
+Coloring ColoringEngine::smallestLast(const CompactGraph &graph) {
+    return greedy(graph, smallestLastOrder(graph));
+}
+
+Coloring ColoringEngine::dsatur(const CompactGraph &graph, int first) {
+    int n = graph.countNodes();
+    Coloring coloring;
+    coloring.color.assign(n, -1);
+    std::vector<ColorMask> seen(n);
+    std::vector<int> saturation(n, 0), degree(n);
+    // lazy heap of (saturation, degree, -id); entries with a stale saturation are skipped
+    std::priority_queue<std::tuple<int, int, int>> heap;
+    for (int v = 0; v < n; v++) {
+        degree[v] = neighbourCount(graph, v);
+        heap.emplace(v == first ? n : 0, degree[v], -v);
+    }
+    while (!heap.empty()) {
+        int v = -std::get<2>(heap.top());
+        int s = std::get<0>(heap.top());
+        heap.pop();
+        if (coloring.color[v] != -1 || (s != saturation[v] && v != first)) continue;
+        int c = seen[v].firstFree();
+        coloring.color[v] = c;
+        forNeighbours(graph, v, [&](int w) {
+            if (coloring.color[w] != -1 || seen[w].test(c)) return;
+            seen[w].set(c);
+            heap.emplace(++saturation[w], degree[w], -w);
+        });
+    }
+    countColors(coloring);
+    return coloring;
+}
+
+Coloring ColoringEngine::jonesPlassmann(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    Coloring coloring;
+    auto &color = coloring.color;
+    color.assign(n, -1);
+    std::vector<std::uint64_t> rank(n);
+    for (int v = 0; v < n; v++)
+        rank[v] = priority(v);
+    auto beats = [&rank](int v, int w) {
+        return rank[v] > rank[w] || (rank[v] == rank[w] && v > w);
+    };
+
+    // waiting[v] counts the neighbours that outrank v and are still uncoloured
+    std::unique_ptr<std::atomic<int>[]> waiting(new std::atomic<int>[n]);
+    std::vector<std::vector<int>> released(Parallel::threadCount());
+    Parallel::forBlocks(n, [&](int tid, int begin, int end) {
+        for (int v = begin; v < end; v++) {
+            int count = 0;
+            forNeighbours(graph, v, [&](int w) {
+                if (beats(w, v)) count++;
+            });
+            waiting[v].store(count, std::memory_order_relaxed);
+            if (count == 0) released[tid].push_back(v);
+        }
+    });
+    std::vector<int> frontier;
+    std::vector<ColorMask> masks(Parallel::threadCount());
+    while (true) {
+        frontier.clear();
+        for (auto &part: released) {
+            frontier.insert(frontier.end(), part.begin(), part.end());
+            part.clear();
+        }
+        if (frontier.empty()) break;
+        // a frontier is an independent set, so every colour read here was fixed in an earlier round
+        Parallel::forBlocks((int) frontier.size(), [&](int tid, int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                int v = frontier[i];
+                color[v] = firstFit(graph, v, color, masks[tid]);
+                forNeighbours(graph, v, [&](int w) {
+                    if (beats(v, w) && waiting[w].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        released[tid].push_back(w);
+                });
+            }
+        }, 512);
+    }
+    countColors(coloring);
+    return coloring;
+}
+
+Coloring ColoringEngine::color(const CompactGraph &graph, ColoringStrategy strategy) {
+    switch (strategy) {
+        case SmallestLast:
+            return smallestLast(graph);
+        case JonesPlassmann:
+            return jonesPlassmann(graph);
+        default:
+            return dsatur(graph);
+    }
+}
+
+bool ColoringEngine::isProper(const CompactGraph &graph, const Coloring &coloring) {
+    for (auto &edge: graph.edges())
+        if (edge.u != edge.v && coloring.color[edge.u] == coloring.color[edge.v])
+            return false;
+    return true;
+}
@@ -0,0 +1,317 @@
+#include "basis/headers/CommunityEngine.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <utility>
+
+using namespace GraphType;
+
+namespace {
+
+    typedef std::pair<int, double> Tie;
+
+    // Weighted undirected graph of one Louvain level; row weights exclude self-loops, which are
+    // kept in self. strength[v] counts self-loops twice, and total is the sum of all strengths.
+    struct Level {
+        int n = 0;
+        std::vector<int> offsets, target;
+        std::vector<double> weight, self, strength;
+        double total = 0;
+
+        void finish() {
+            strength.assign(n, 0);
+            total = 0;
+            for (int v = 0; v < n; v++) {
+                strength[v] = 2 * self[v];
+                for (int a = offsets[v]; a < offsets[v + 1]; a++)
+                    strength[v] += weight[a];
+                total += strength[v];
+            }
+        }
+    };
+
+    // Sorts ties by key and adds up equal keys in place
+    void tally(std::vector<Tie> &ties) {
+        std::sort(ties.begin(), ties.end(), [](const Tie &a, const Tie &b) { return a.first < b.first; });
+        size_t kept = 0;
+        for (size_t i = 0; i < ties.size(); i++) {
+            if (kept > 0 && ties[kept - 1].first == ties[i].first)
+                ties[kept - 1].second += ties[i].second;
+            else
+                ties[kept++] = ties[i];
+        }
+        ties.resize(kept);
+    }
+
+    Level baseLevel(const CompactGraph &graph) {
+        Level level;
+        int n = level.n = graph.countNodes();
+        level.self.assign(n, 0);
+        std::vector<std::vector<Tie>> rows(n);
+        for (auto &edge: graph.edges()) {
+            double w = graph.isWeighted() ? std::max(edge.weight, 0) : 1;
+            if (edge.u == edge.v)
+                level.self[edge.u] += w;
+            else {
+                rows[edge.u].emplace_back(edge.v, w);
+                rows[edge.v].emplace_back(edge.u, w);
+            }
+        }
+        level.offsets.assign(n + 1, 0);
+        for (int v = 0; v < n; v++) {
+            tally(rows[v]);
+            level.offsets[v + 1] = level.offsets[v] + (int) rows[v].size();
+        }
+        level.target.resize(level.offsets[n]);
+        level.weight.resize(level.offsets[n]);
+        for (int v = 0; v < n; v++) {
+            for (size_t i = 0; i < rows[v].size(); i++) {
+                level.target[level.offsets[v] + i] = rows[v][i].first;
+                level.weight[level.offsets[v] + i] = rows[v][i].second;
+            }
+            std::vector<Tie>().swap(rows[v]);
+        }
+        level.finish();
+        return level;
+    }
+
+    double levelModularity(const Level &level, const std::vector<int> &community) {
+        if (level.total <= 0) return 0;
+        std::vector<double> inside(level.n, 0), tot(level.n, 0);
+        for (int v = 0; v < level.n; v++) {
+            int c = community[v];
+            tot[c] += level.strength[v];
+            inside[c] += 2 * level.self[v];
+            for (int a = level.offsets[v]; a < level.offsets[v + 1]; a++)
+                if (community[level.target[a]] == c)
+                    inside[c] += level.weight[a];
+        }
+        double q = 0;
+        for (int c = 0; c < level.n; c++)
+            q += inside[c] / level.total - (tot[c] / level.total) * (tot[c] / level.total);
+        return q;
+    }
+
+    // Renumbers community ids to [0, count) by first appearance and returns count
+    int compact(std::vector<int> &community) {
+        std::vector<int> label(community.size(), -1);
+        int count = 0;
+        for (auto &c: community) {
+            if (label[c] == -1)
+                label[c] = count++;
+            c = label[c];
+        }
+        return count;
+    }
+
+    void atomicAdd(std::atomic<double> &x, double delta) {
+        double current = x.load(std::memory_order_relaxed);
+        while (!x.compare_exchange_weak(current, current + delta, std::memory_order_relaxed));
+    }
+
+    // Local moving phase on one level; returns the final modularity
+    double moveNodes(const Level &level, std::vector<int> &community, double tolerance, int max_sweeps) {
+        int n = level.n;
+        std::unique_ptr<std::atomic<int>[]> member(new std::atomic<int>[n]);
+        std::unique_ptr<std::atomic<double>[]> tot(new std::atomic<double>[n]);
+        for (int v = 0; v < n; v++) {
+            member[v].store(community[v], std::memory_order_relaxed);
+            tot[v].store(0, std::memory_order_relaxed);
+        }
+        for (int v = 0; v < n; v++)
+            atomicAdd(tot[community[v]], level.strength[v]);
+        double quality = levelModularity(level, community);
+        std::vector<std::vector<Tie>> buffers(Parallel::threadCount());
+
+        for (int sweep = 0; sweep < max_sweeps; sweep++) {
+            Parallel::forBlocks(n, [&](int tid, int begin, int end) {
+                auto &ties = buffers[tid];
+                for (int v = begin; v < end; v++) {
+                    int own = member[v].load(std::memory_order_relaxed);
+                    ties.clear();
+                    for (int a = level.offsets[v]; a < level.offsets[v + 1]; a++)
+                        ties.emplace_back(member[level.target[a]].load(std::memory_order_relaxed), level.weight[a]);
+                    if (ties.empty()) continue;
+                    tally(ties);
+                    double k = level.strength[v], to_own = 0;
+                    for (auto &tie: ties)
+                        if (tie.first == own) to_own = tie.second;
+                    // gains are scaled by total / 2 and measured against leaving v alone
+                    double stay = to_own - k * (tot[own].load(std::memory_order_relaxed) - k) / level.total;
+                    double best = 0;
+                    int chosen = own;
+                    for (auto &tie: ties) {
+                        if (tie.first == own) continue;
+                        double gain = tie.second - k * tot[tie.first].load(std::memory_order_relaxed) / level.total
+                                      - stay;
+                        if (gain > best) {
+                            best = gain;
+                            chosen = tie.first;
+                        }
+                    }
+                    if (chosen != own) {
+                        atomicAdd(tot[own], -k);
+                        atomicAdd(tot[chosen], k);
+                        member[v].store(chosen, std::memory_order_relaxed);
+                    }
+                }
+            }, 1024);
+
+            std::vector<int> moved(n);
+            for (int v = 0; v < n; v++)
+                moved[v] = member[v].load(std::memory_order_relaxed);
+            // concurrent moves are decided on slightly stale totals, so a sweep can lose quality
+            double moved_quality = levelModularity(level, moved);
+            if (moved_quality > quality)
+                community.swap(moved);
+            if (moved_quality - quality < tolerance)
+                return std::max(quality, moved_quality);
+            quality = moved_quality;
+        }
+        return quality;
+    }
+
+    // Collapses every community of level into one node
+    Level aggregate(const Level &level, const std::vector<int> &community, int count) {
+        Level result;
+        result.n = count;
+        result.self.assign(count, 0);
+        std::vector<int> start(count + 1, 0), members(level.n);
+        for (int v = 0; v < level.n; v++)
+            start[community[v] + 1]++;
+        for (int c = 0; c < count; c++)
+            start[c + 1] += start[c];
+        std::vector<int> fill(start.begin(), start.end() - 1);
+        for (int v = 0; v < level.n; v++)
+            members[fill[community[v]]++] = v;
+
+        std::vector<std::vector<Tie>> rows(count);
+        Parallel::forDynamic(count, [&](int, int c) {
+            auto &row = rows[c];
+            for (int i = start[c]; i < start[c + 1]; i++) {
+                int v = members[i];
+                result.self[c] += level.self[v];
+                for (int a = level.offsets[v]; a < level.offsets[v + 1]; a++) {
+                    int d = community[level.target[a]];
+                    // an inner edge is seen from both ends, each adding half of it
+                    if (d == c)
+                        result.self[c] += level.weight[a] / 2;
+                    else
+                        row.emplace_back(d, level.weight[a]);
+                }
+            }
+            tally(row);
+        });
+        result.offsets.assign(count + 1, 0);
+        for (int c = 0; c < count; c++)
+            result.offsets[c + 1] = result.offsets[c] + (int) rows[c].size();
+        result.target.resize(result.offsets[count]);
+        result.weight.resize(result.offsets[count]);
+        for (int c = 0; c < count; c++)
+            for (size_t i = 0; i < rows[c].size(); i++) {
+                result.target[result.offsets[c] + i] = rows[c][i].first;
+                result.weight[result.offsets[c] + i] = rows[c][i].second;
+            }
+        result.finish();
+        return result;
+    }
+}
+
+double CommunityEngine::modularity(const CompactGraph &graph, const std::vector<int> &community) {
+    std::vector<int> labels(community);
+    compact(labels);
+    return levelModularity(baseLevel(graph), labels);
+}
+
+Communities CommunityEngine::louvain(const CompactGraph &graph, double tolerance, int max_sweeps) {
+    Communities result;
+    int n = graph.countNodes();
+    Level level = baseLevel(graph);
+    // membership maps original nodes to nodes of the current level
+    std::vector<int> membership(n);
+    for (int v = 0; v < n; v++)
+        membership[v] = v;
+
+    while (level.n > 0) {
+        std::vector<int> community(level.n);
+        for (int v = 0; v < level.n; v++)
+            community[v] = v;
+        result.modularity = moveNodes(level, community, tolerance, max_sweeps);
+        int count = compact(community);
+        result.rounds++;
+        for (auto &m: membership)
+            m = community[m];
+        if (count == level.n) break;
+        level = aggregate(level, community, count);
+    }
+    result.community.swap(membership);
+    result.count = compact(result.community);
+    if (n == 0) result.modularity = 0;
+    return result;
+}
+
+Communities CommunityEngine::labelPropagation(const CompactGraph &graph, int max_iterations, unsigned seed) {
+    Communities result;
+    int n = graph.countNodes();
+    Level level = baseLevel(graph);
+    std::unique_ptr<std::atomic<int>[]> label(new std::atomic<int>[n]);
+    for (int v = 0; v < n; v++)
+        label[v].store(v, std::memory_order_relaxed);
+    std::vector<int> order(n);
+    for (int v = 0; v < n; v++)
+        order[v] = v;
+    std::mt19937 shuffle_rng(seed);
+    std::shuffle(order.begin(), order.end(), shuffle_rng);
+
+    int threads = Parallel::threadCount();
+    std::vector<std::vector<Tie>> buffers(threads);
+    std::vector<long long> changes(threads);
+    while (result.rounds < max_iterations) {
+        result.rounds++;
+        std::fill(changes.begin(), changes.end(), 0);
+        // labels are read and written in place, so later nodes already see this sweep's moves
+        Parallel::forBlocks(n, [&](int tid, int begin, int end) {
+            std::mt19937 rng(seed + 7919u * result.rounds + tid);
+            auto &ties = buffers[tid];
+            for (int i = begin; i < end; i++) {
+                int v = order[i];
+                ties.clear();
+                for (int a = level.offsets[v]; a < level.offsets[v + 1]; a++)
+                    ties.emplace_back(label[level.target[a]].load(std::memory_order_relaxed), level.weight[a]);
+                if (ties.empty()) continue;
+                tally(ties);
+                int own = label[v].load(std::memory_order_relaxed), chosen = own, seen = 0;
+                double best = -1;
+                for (auto &tie: ties)
+                    if (tie.second > best)
+                        best = tie.second;
+                for (auto &tie: ties) {
+                    if (tie.second < best) continue;
+                    if (tie.first == own) {
+                        chosen = own;
+                        break;
+                    }
+                    // reservoir sampling picks uniformly among the tied labels
+                    if (rng() % ++seen == 0)
+                        chosen = tie.first;
+                }
+                if (chosen != own) {
+                    label[v].store(chosen, std::memory_order_relaxed);
+                    changes[tid]++;
+                }
+            }
+        }, 1024);
+        long long changed = 0;
+        for (long long c: changes)
+            changed += c;
+        if (changed == 0) break;
+    }
+    result.community.resize(n);
+    for (int v = 0; v < n; v++)
+        result.community[v] = label[v].load(std::memory_order_relaxed);
+    result.count = compact(result.community);
+    result.modularity = levelModularity(level, result.community);
+    return result;
+}
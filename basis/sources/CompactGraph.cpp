@@ -0,0 +1,96 @@
+#include "basis/headers/CompactGraph.h"
+#include <algorithm>
+
+using namespace GraphType;
+
+CompactGraph::CompactGraph(const Graph &graph) :
+        _directed(graph.isDirected()),
+        _weighted(graph.isWeighted()) {
+    std::unordered_map<const Node *, int> node_index(graph.countNodes());
+    _names.reserve(graph.countNodes());
+    _ids.reserve(graph.countNodes());
+    for (auto node: graph.nodeList()) {
+        node_index[node] = (int) _names.size();
+        _ids[node->name()] = (int) _names.size();
+        _names.push_back(node->name());
+    }
+
+    std::vector<CompactEdge> unsorted;
+    unsorted.reserve(graph.countEdges());
+    for (auto it = graph.edgeSet().begin(); it != graph.edgeSet().end(); ++it) {
+        auto edge = Edge(it);
+        unsorted.push_back({node_index[edge.u()], node_index[edge.v()], edge.weight()});
+    }
+    // two stable counting passes, by v and then by u, leave the edges ordered by (u, v)
+    std::vector<int> count(countNodes() + 1);
+    _edges.resize(unsorted.size());
+    for (int pass = 0; pass < 2; pass++) {
+        auto key = [pass](const CompactEdge &edge) { return pass == 0 ? edge.v : edge.u; };
+        std::fill(count.begin(), count.end(), 0);
+        for (auto &edge: unsorted)
+            count[key(edge) + 1]++;
+        for (int i = 0; i < countNodes(); i++)
+            count[i + 1] += count[i];
+        for (auto &edge: unsorted)
+            _edges[count[key(edge)]++] = edge;
+        if (pass == 0)
+            unsorted.swap(_edges);
+    }
+
+    _buildRows(countNodes(), _edges, false, !_directed, _outOffsets, _outTargets, _outEdges);
+    _buildRows(countNodes(), _edges, true, !_directed, _inOffsets, _inSources, _inEdges);
+}
+
+void CompactGraph::_buildRows(int node_num, const std::vector<CompactEdge> &edges, bool reversed, bool both_ways,
+                              std::vector<int> &offsets, std::vector<int> &targets, std::vector<int> &edge_ids) {
+    offsets.assign(node_num + 1, 0);
+    for (auto &edge: edges) {
+        offsets[(reversed ? edge.v : edge.u) + 1]++;
+        if (both_ways)
+            offsets[(reversed ? edge.u : edge.v) + 1]++;
+    }
+    for (int i = 0; i < node_num; i++)
+        offsets[i + 1] += offsets[i];
+
+    targets.resize(offsets[node_num]);
+    edge_ids.resize(offsets[node_num]);
+    std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+    auto place = [&](int from, int to, int edge_id) {
+        targets[cursor[from]] = to;
+        edge_ids[cursor[from]++] = edge_id;
+    };
+    for (int i = 0; i < (int) edges.size(); i++) {
+        int from = reversed ? edges[i].v : edges[i].u;
+        int to = reversed ? edges[i].u : edges[i].v;
+        place(from, to, i);
+        if (both_ways)
+            place(to, from, i);
+    }
+
+    // rows come out sorted except where an undirected edge is placed from its second end
+    std::vector<std::pair<int, int>> row;
+    for (int u = 0; u < node_num; u++) {
+        if (std::is_sorted(targets.begin() + offsets[u], targets.begin() + offsets[u + 1]))
+            continue;
+        row.clear();
+        for (int a = offsets[u]; a < offsets[u + 1]; a++)
+            row.emplace_back(targets[a], edge_ids[a]);
+        std::sort(row.begin(), row.end());
+        for (int a = offsets[u]; a < offsets[u + 1]; a++) {
+            targets[a] = row[a - offsets[u]].first;
+            edge_ids[a] = row[a - offsets[u]].second;
+        }
+    }
+}
+
+int CompactGraph::id(const std::string &node_name) const {
+    auto it = _ids.find(node_name);
+    return it != _ids.end() ? it->second : -1;
+}
+
+int CompactGraph::maxWeight() const {
+    int result = 0;
+    for (auto &edge: _edges)
+        result = std::max(result, edge.weight);
+    return result;
+}
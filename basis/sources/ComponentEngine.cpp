@@ -0,0 +1,140 @@
+#include "basis/headers/ComponentEngine.h"
+#include "utils/parallel.h"
+#include "utils/random.h"
+#include "utils/unionfind.h"
+#include <algorithm>
+#include <unordered_map>
+
+using namespace GraphType;
+
+std::vector<std::vector<int>> ComponentLabels::groups() const {
+    std::vector<std::vector<int>> result(count);
+    for (int v = 0; v < (int) component.size(); v++)
+        result[component[v]].push_back(v);
+    return result;
+}
+
+ComponentLabels ComponentEngine::stronglyConnected(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    ComponentLabels labels;
+    labels.component.assign(n, -1);
+    std::vector<int> index(n, -1), low(n, 0);
+    std::vector<bool> onStack(n, false);
+    std::vector<int> stack;
+    std::vector<std::pair<int, int>> frames;
+    int counter = 0;
+
+    for (int s = 0; s < n; s++) {
+        if (index[s] != -1) continue;
+        index[s] = low[s] = counter++;
+        stack.push_back(s);
+        onStack[s] = true;
+        frames.emplace_back(s, graph.outBegin(s));
+        while (!frames.empty()) {
+            int v = frames.back().first;
+            int &arc = frames.back().second;
+            if (arc < graph.outEnd(v)) {
+                int w = graph.target(arc++);
+                if (index[w] == -1) {
+                    index[w] = low[w] = counter++;
+                    stack.push_back(w);
+                    onStack[w] = true;
+                    frames.emplace_back(w, graph.outBegin(w));
+                } else if (onStack[w])
+                    low[v] = std::min(low[v], index[w]);
+                continue;
+            }
+            frames.pop_back();
+            if (!frames.empty())
+                low[frames.back().first] = std::min(low[frames.back().first], low[v]);
+            if (low[v] != index[v]) continue;
+            int w;
+            do {
+                w = stack.back();
+                stack.pop_back();
+                onStack[w] = false;
+                labels.component[w] = labels.count;
+            } while (w != v);
+            labels.count++;
+        }
+    }
+    // Tarjan closes sink components first; flip so ids follow the topological order
+    for (auto &c: labels.component)
+        c = labels.count - 1 - c;
+    return labels;
+}
+
+bool ComponentEngine::isStronglyConnected(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    if (n <= 1) return true;
+    std::vector<int> queue;
+    for (int pass = 0; pass < 2; pass++) {
+        std::vector<bool> seen(n, false);
+        queue.assign(1, 0);
+        seen[0] = true;
+        for (size_t i = 0; i < queue.size(); i++) {
+            int v = queue[i];
+            int end = pass == 0 ? graph.outEnd(v) : graph.inEnd(v);
+            for (int a = pass == 0 ? graph.outBegin(v) : graph.inBegin(v); a < end; a++) {
+                int w = pass == 0 ? graph.target(a) : graph.source(a);
+                if (!seen[w]) {
+                    seen[w] = true;
+                    queue.push_back(w);
+                }
+            }
+        }
+        if ((int) queue.size() < n) return false;
+    }
+    return true;
+}
+
+ComponentLabels ComponentEngine::weaklyConnected(const CompactGraph &graph, int neighbour_rounds) {
+    int n = graph.countNodes();
+    ConcurrentUnionFind sets(n);
+    auto compressAll = [&]() {
+        Parallel::forBlocks(n, [&](int, int begin, int end) {
+            for (int v = begin; v < end; v++)
+                sets.compress(v);
+        });
+    };
+
+    for (int r = 0; r < neighbour_rounds; r++) {
+        Parallel::forBlocks(n, [&](int, int begin, int end) {
+            for (int u = begin; u < end; u++)
+                if (r < graph.outDegree(u))
+                    sets.unite(u, graph.target(graph.outBegin(u) + r));
+        });
+        compressAll();
+    }
+
+    int frequent = -1;
+    if (n > 0) {
+        Random random(n);
+        std::unordered_map<int, int> samples;
+        int best = 0;
+        for (int i = 0; i < 1024; i++) {
+            int c = sets.parent((int) random.drawNumber(0, n - 1));
+            if (++samples[c] > best)
+                best = samples[c], frequent = c;
+        }
+    }
+
+    auto &edges = graph.edges();
+    Parallel::forBlocks((int) edges.size(), [&](int, int begin, int end) {
+        for (int e = begin; e < end; e++)
+            if (sets.parent(edges[e].u) != frequent || sets.parent(edges[e].v) != frequent)
+                sets.unite(edges[e].u, edges[e].v);
+    });
+    compressAll();
+
+    ComponentLabels labels;
+    labels.component.assign(n, -1);
+    std::vector<int> root_label(n, -1);
+    for (int v = 0; v < n; v++) {
+        int root = sets.parent(v);
+        if (root_label[root] == -1)
+            root_label[root] = labels.count++;
+        labels.component[v] = root_label[root];
+    }
+    return labels;
+}
@@ -0,0 +1,145 @@
+#include "basis/headers/CoreEngine.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+using namespace GraphType;
+
+namespace {
+
+    // CSR of distinct neighbours without self-loops, merging out- and in-rows of directed graphs
+    struct SimpleRows {
+        int n;
+        std::vector<int> offsets, neighbours;
+
+        explicit SimpleRows(const CompactGraph &graph) : n(graph.countNodes()), offsets(n + 1, 0) {
+            Parallel::forBlocks(n, [&](int, int begin, int end) {
+                for (int v = begin; v < end; v++)
+                    graph.forSimpleNeighbours(v, [&](int, int) { offsets[v + 1]++; });
+            });
+            for (int v = 0; v < n; v++)
+                offsets[v + 1] += offsets[v];
+            neighbours.resize(offsets[n]);
+            Parallel::forBlocks(n, [&](int, int begin, int end) {
+                for (int v = begin; v < end; v++) {
+                    int next = offsets[v];
+                    graph.forSimpleNeighbours(v, [&](int w, int) { neighbours[next++] = w; });
+                }
+            });
+        }
+
+        int degree(int v) const { return offsets[v + 1] - offsets[v]; }
+    };
+}
+
+CoreDecomposition CoreEngine::batageljZaversnik(const CompactGraph &graph) {
+    SimpleRows rows(graph);
+    int n = rows.n;
+    CoreDecomposition result;
+    result.core.assign(n, 0);
+    if (n == 0) return result;
+
+    // vert holds the nodes sorted by current degree, bin[d] is where degree d starts in vert and
+    // pos[v] is where v sits
+    auto &degree = result.core;
+    int max_degree = 0;
+    for (int v = 0; v < n; v++) {
+        degree[v] = rows.degree(v);
+        max_degree = std::max(max_degree, degree[v]);
+    }
+    std::vector<int> bin(max_degree + 2, 0), vert(n), pos(n);
+    for (int v = 0; v < n; v++)
+        bin[degree[v] + 1]++;
+    for (int d = 0; d <= max_degree; d++)
+        bin[d + 1] += bin[d];
+    for (int v = 0; v < n; v++) {
+        pos[v] = bin[degree[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (int d = max_degree; d > 0; d--)
+        bin[d] = bin[d - 1];
+    bin[0] = 0;
+
+    for (int i = 0; i < n; i++) {
+        int v = vert[i];
+        for (int a = rows.offsets[v]; a < rows.offsets[v + 1]; a++) {
+            int w = rows.neighbours[a];
+            if (degree[w] <= degree[v]) continue;
+            // swap w with the first node of its bucket, then shrink the bucket past it
+            int dw = degree[w], first = bin[dw], u = vert[first];
+            if (u != w) {
+                std::swap(vert[pos[w]], vert[first]);
+                pos[u] = pos[w];
+                pos[w] = first;
+            }
+            bin[dw]++;
+            degree[w]--;
+        }
+    }
+    result.degeneracy = *std::max_element(result.core.begin(), result.core.end());
+    return result;
+}
+
+CoreDecomposition CoreEngine::parallelPeeling(const CompactGraph &graph) {
+    SimpleRows rows(graph);
+    int n = rows.n;
+    CoreDecomposition result;
+    result.core.assign(n, 0);
+    if (n == 0) return result;
+
+    std::unique_ptr<std::atomic<int>[]> degree(new std::atomic<int>[n]);
+    for (int v = 0; v < n; v++)
+        degree[v].store(rows.degree(v), std::memory_order_relaxed);
+    // removed[v] is set once v has been taken into some level's frontier
+    std::unique_ptr<std::atomic<char>[]> removed(new std::atomic<char>[n]);
+    for (int v = 0; v < n; v++)
+        removed[v].store(0, std::memory_order_relaxed);
+
+    std::vector<int> remaining(n), frontier, next;
+    for (int v = 0; v < n; v++)
+        remaining[v] = v;
+    int threads = Parallel::threadCount();
+    std::vector<std::vector<int>> found(threads);
+
+    for (int k = 0; !remaining.empty(); k++) {
+        // the nodes of degree <= k start this level
+        frontier.clear();
+        for (int v: remaining)
+            if (degree[v].load(std::memory_order_relaxed) <= k) {
+                removed[v].store(1, std::memory_order_relaxed);
+                frontier.push_back(v);
+            }
+        while (!frontier.empty()) {
+            for (auto &list: found)
+                list.clear();
+            Parallel::forBlocks((int) frontier.size(), [&](int tid, int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    int v = frontier[i];
+                    result.core[v] = k;
+                    for (int a = rows.offsets[v]; a < rows.offsets[v + 1]; a++) {
+                        int w = rows.neighbours[a];
+                        if (removed[w].load(std::memory_order_relaxed)) continue;
+                        // only the decrement that lands exactly on k claims w for this level
+                        if (degree[w].fetch_sub(1, std::memory_order_relaxed) == k + 1 &&
+                            !removed[w].exchange(1, std::memory_order_relaxed))
+                            found[tid].push_back(w);
+                    }
+                }
+            }, 256);
+            next.clear();
+            for (auto &list: found)
+                next.insert(next.end(), list.begin(), list.end());
+            frontier.swap(next);
+        }
+        remaining.erase(std::remove_if(remaining.begin(), remaining.end(), [&](int v) {
+            return removed[v].load(std::memory_order_relaxed) != 0;
+        }), remaining.end());
+    }
+    result.degeneracy = *std::max_element(result.core.begin(), result.core.end());
+    return result;
+}
+
+CoreDecomposition CoreEngine::decompose(const CompactGraph &graph) {
+    return Parallel::threadCount() > 1 ? parallelPeeling(graph) : batageljZaversnik(graph);
+}
@@ -0,0 +1,254 @@
+#include "basis/headers/DistanceEngine.h"
+#include "basis/headers/ComponentEngine.h"
+#include "utils/bits.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+using namespace GraphType;
+
+namespace {
+
+    // Per-thread bitsets of a multi-source BFS, words 64-bit words per node. seen marks the sources
+    // that reached a node, visit those that reached it on the current level and next those that
+    // reach it on the following one.
+    struct Workspace {
+        int words;
+        std::vector<std::uint64_t> seen, visit, next;
+        std::vector<int> frontier, touched, visited;
+        // nodes each source reached on the current level
+        std::vector<int> found;
+
+        Workspace(int n, int words) : words(words), seen((size_t) n * words, 0), visit((size_t) n * words, 0),
+                                      next((size_t) n * words, 0), found(64 * words, 0) {}
+    };
+
+    // One batch of at most 64 * words sources; leaves the workspace clean
+    void traverseBatch(const CompactGraph &graph, const int *sources, int count, Workspace &space, Reach *reach) {
+        int words = space.words;
+        space.frontier.clear();
+        space.visited.clear();
+        for (int i = 0; i < count; i++) {
+            size_t row = (size_t) sources[i] * words;
+            bool queued = false;
+            for (int k = 0; k < words; k++)
+                queued |= space.visit[row + k] != 0;
+            if (!queued) {
+                space.frontier.push_back(sources[i]);
+                space.visited.push_back(sources[i]);
+            }
+            space.seen[row + i / 64] |= std::uint64_t(1) << (i % 64);
+            space.visit[row + i / 64] |= std::uint64_t(1) << (i % 64);
+            reach[i] = Reach();
+            reach[i].reached = 1;
+        }
+
+        for (int level = 1; !space.frontier.empty(); level++) {
+            space.touched.clear();
+            for (int v: space.frontier) {
+                const std::uint64_t *visit = &space.visit[(size_t) v * words];
+                for (int a = graph.outBegin(v); a < graph.outEnd(v); a++) {
+                    size_t row = (size_t) graph.target(a) * words;
+                    std::uint64_t fresh = 0, queued = 0;
+                    for (int k = 0; k < words; k++) {
+                        std::uint64_t bits = visit[k] & ~space.seen[row + k];
+                        queued |= space.next[row + k];
+                        space.next[row + k] |= bits;
+                        fresh |= bits;
+                    }
+                    if (fresh && !queued)
+                        space.touched.push_back(graph.target(a));
+                }
+            }
+            for (int v: space.frontier)
+                std::fill_n(space.visit.begin() + (size_t) v * words, words, 0);
+
+            // seen only grows here, so next never held a source that had already reached its node
+            for (int w: space.touched) {
+                size_t row = (size_t) w * words;
+                for (int k = 0; k < words; k++) {
+                    std::uint64_t bits = space.next[row + k];
+                    space.seen[row + k] |= bits;
+                    space.visit[row + k] = bits;
+                    space.next[row + k] = 0;
+                    for (; bits; bits &= bits - 1)
+                        space.found[k * 64 + Bits::lowest(bits)]++;
+                }
+            }
+            for (int i = 0; i < count; i++) {
+                if (space.found[i] == 0) continue;
+                reach[i].eccentricity = level;
+                reach[i].reached += space.found[i];
+                reach[i].distances += (long long) space.found[i] * level;
+                space.found[i] = 0;
+            }
+            space.visited.insert(space.visited.end(), space.touched.begin(), space.touched.end());
+            space.frontier.swap(space.touched);
+        }
+        for (int v: space.visited)
+            std::fill_n(space.seen.begin() + (size_t) v * words, words, 0);
+    }
+
+    // Plain BFS keeping parents; the queue lists the reached nodes level by level
+    struct Sweep {
+        std::vector<int> dist, parent, queue;
+
+        explicit Sweep(int n) : dist(n, -1), parent(n, -1) {}
+
+        // Returns the last node reached, one of the farthest from source
+        int from(const CompactGraph &graph, int source) {
+            queue.clear();
+            queue.push_back(source);
+            dist[source] = 0;
+            for (size_t head = 0; head < queue.size(); head++) {
+                int v = queue[head];
+                for (int a = graph.outBegin(v); a < graph.outEnd(v); a++) {
+                    int w = graph.target(a);
+                    if (dist[w] != -1) continue;
+                    dist[w] = dist[v] + 1;
+                    parent[w] = v;
+                    queue.push_back(w);
+                }
+            }
+            return queue.back();
+        }
+
+        void reset() {
+            for (int v: queue)
+                dist[v] = parent[v] = -1;
+        }
+    };
+}
+
+std::vector<Reach> DistanceEngine::traverse(const CompactGraph &graph, const std::vector<int> &sources) {
+    int n = graph.countNodes(), count = (int) sources.size();
+    std::vector<Reach> reach(count);
+    if (count == 0) return reach;
+
+    // the widest batches that still give every thread one, with each thread's bitsets under 64 MB
+    int threads = Parallel::threadCount();
+    int words = batchSize / 64;
+    while (words > 1 && ((long long) words * 64 * threads > count ||
+                         (size_t) n * words * 3 * sizeof(std::uint64_t) > (size_t(64) << 20)))
+        words /= 2;
+    int width = 64 * words, batches = (count + width - 1) / width;
+
+    std::vector<std::unique_ptr<Workspace>> spaces(threads);
+    Parallel::forDynamic(batches, [&](int tid, int b) {
+        if (!spaces[tid])
+            spaces[tid].reset(new Workspace(n, words));
+        int begin = b * width;
+        traverseBatch(graph, sources.data() + begin, std::min(width, count - begin), *spaces[tid],
+                      reach.data() + begin);
+    });
+    return reach;
+}
+
+Eccentricities DistanceEngine::eccentricities(const CompactGraph &graph, int samples, unsigned seed) {
+    int n = graph.countNodes();
+    Eccentricities result;
+    result.eccentricity.assign(n, 0);
+    result.closeness.assign(n, 0);
+    if (n == 0) return result;
+
+    std::vector<int> sources(n);
+    for (int v = 0; v < n; v++)
+        sources[v] = v;
+    if (samples > 0 && samples < n) {
+        std::mt19937 rng(seed);
+        for (int i = 0; i < samples; i++)
+            std::swap(sources[i], sources[i + rng() % (n - i)]);
+        sources.resize(samples);
+        result.exact = false;
+    }
+    auto reach = traverse(graph, sources);
+    result.radius = n;
+    for (int i = 0; i < (int) sources.size(); i++) {
+        int v = sources[i];
+        result.eccentricity[v] = reach[i].eccentricity;
+        if (reach[i].distances > 0) {
+            double r = reach[i].reached - 1;
+            result.closeness[v] = r * r / ((n - 1) * (double) reach[i].distances);
+        }
+        result.diameter = std::max(result.diameter, reach[i].eccentricity);
+        result.radius = std::min(result.radius, reach[i].eccentricity);
+        result.connected &= reach[i].reached == n;
+    }
+    result.sources.swap(sources);
+    return result;
+}
+
+Diameter DistanceEngine::diameter(const CompactGraph &graph, int max_traversals) {
+    Diameter result;
+    if (graph.isDirected()) {
+        int n = graph.countNodes();
+        bool sampled = max_traversals > 0 && max_traversals < n;
+        auto distances = eccentricities(graph, sampled ? max_traversals : 0);
+        result.lower = result.upper = distances.diameter;
+        result.traversals = (int) distances.sources.size();
+        // a shortest path never leaves its weakly connected component nor repeats a node
+        if (sampled)
+            for (auto &members: ComponentEngine::weaklyConnected(graph).groups())
+                result.upper = std::max(result.upper, (int) members.size() - 1);
+        return result;
+    }
+
+    auto groups = ComponentEngine::weaklyConnected(graph).groups();
+    std::stable_sort(groups.begin(), groups.end(), [](const std::vector<int> &a, const std::vector<int> &b) {
+        return a.size() > b.size();
+    });
+    Sweep sweep(graph.countNodes());
+    std::vector<int> fringe;
+    for (auto &members: groups) {
+        int size = (int) members.size();
+        // no component can beat the bound once it is too small to hold a longer path
+        if (size - 1 <= result.lower) break;
+        if (max_traversals > 0 && result.traversals >= max_traversals) {
+            result.upper = std::max(result.upper, size - 1);
+            continue;
+        }
+
+        // double sweep from the highest degree node; u is halfway along the long path it finds
+        int start = members[0];
+        for (int v: members)
+            if (graph.outEnd(v) - graph.outBegin(v) > graph.outEnd(start) - graph.outBegin(start))
+                start = v;
+        int a = sweep.from(graph, start);
+        sweep.reset();
+        int b = sweep.from(graph, a), u = b;
+        int lower = std::max(result.lower, sweep.dist[b]);
+        for (int step = 0; step < sweep.dist[b] / 2; step++)
+            u = sweep.parent[u];
+        sweep.reset();
+        sweep.from(graph, u);
+        result.traversals += 3;
+
+        // any two nodes within the levels left are at most 2 * level apart
+        int level = sweep.dist[sweep.queue.back()], end = size;
+        while (2 * level > lower && (max_traversals <= 0 || result.traversals < max_traversals)) {
+            int begin = end;
+            while (begin > 0 && sweep.dist[sweep.queue[begin - 1]] == level)
+                begin--;
+            // a level cut short by the budget is left unfinished, keeping 2 * level as the bound
+            if (max_traversals > 0)
+                begin = std::max(begin, end - (max_traversals - result.traversals));
+            fringe.assign(sweep.queue.begin() + begin, sweep.queue.begin() + end);
+            for (auto &reach: traverse(graph, fringe))
+                lower = std::max(lower, reach.eccentricity);
+            result.traversals += (int) fringe.size();
+            if (begin > 0 && sweep.dist[sweep.queue[begin - 1]] == level) {
+                end = begin;
+                continue;
+            }
+            end = begin;
+            level--;
+        }
+        sweep.reset();
+        result.lower = lower;
+        result.upper = std::max(result.upper, std::min(std::max(lower, 2 * level), size - 1));
+    }
+    result.upper = std::max(result.upper, result.lower);
+    return result;
+}
@@ -0,0 +1,86 @@
+#include "basis/headers/EulerianEngine.h"
+#include "basis/headers/ComponentEngine.h"
+#include <algorithm>
+
+using namespace GraphType;
+
+EulerianKind EulerianEngine::classify(const CompactGraph &graph, int &start) {
+    int n = graph.countNodes();
+    start = -1;
+    int plus = 0, minus = 0;
+    for (int v = 0; v < n; v++) {
+        if (graph.isDirected()) {
+            int diff = graph.outDegree(v) - graph.inDegree(v);
+            if (diff == 1 && plus++ == 0)
+                start = v;
+            else if (diff == -1)
+                minus++;
+            else if (diff != 0)
+                return NoTrail;
+        } else if (graph.outDegree(v) % 2 == 1 && plus++ == 0)
+            start = v;
+    }
+    EulerianKind kind;
+    if (plus == 0 && minus == 0)
+        kind = ClosedTrail;
+    else if (graph.isDirected() ? (plus == 1 && minus == 1) : plus == 2)
+        kind = OpenTrail;
+    else
+        return NoTrail;
+
+    auto labels = ComponentEngine::weaklyConnected(graph);
+    int label = -1;
+    for (int v = 0; v < n; v++) {
+        if (graph.outDegree(v) == 0 && graph.inDegree(v) == 0) continue;
+        if (label == -1) {
+            label = labels.component[v];
+            if (start == -1) start = v;
+        } else if (labels.component[v] != label)
+            return NoTrail;
+    }
+    return kind;
+}
+
+EulerianTrail EulerianEngine::find(const CompactGraph &graph, int source) {
+    EulerianTrail trail;
+    int start;
+    trail.kind = classify(graph, start);
+    if (trail.kind == NoTrail || graph.countNodes() == 0) return trail;
+    if (trail.kind == ClosedTrail && source >= 0 && (graph.outDegree(source) > 0 || graph.countEdges() == 0))
+        start = source;
+    if (start == -1)
+        start = std::max(source, 0);
+
+    std::vector<int> cursor(graph.countNodes());
+    for (int v = 0; v < graph.countNodes(); v++)
+        cursor[v] = graph.outBegin(v);
+    std::vector<bool> used(graph.countEdges(), false);
+    std::vector<int> stack(1, start);
+    while (!stack.empty()) {
+        int v = stack.back();
+        int &arc = cursor[v];
+        while (arc < graph.outEnd(v) && used[graph.arcEdge(arc)])
+            arc++;
+        if (arc == graph.outEnd(v)) {
+            trail.nodes.push_back(v);
+            stack.pop_back();
+            continue;
+        }
+        used[graph.arcEdge(arc)] = true;
+        stack.push_back(graph.target(arc++));
+    }
+    std::reverse(trail.nodes.begin(), trail.nodes.end());
+    return trail;
+}
+
+std::vector<int> EulerianEngine::rotate(const std::vector<int> &circuit, int source) {
+    std::vector<int> result;
+    auto it = std::find(circuit.begin(), circuit.end(), source);
+    if (it == circuit.end()) return result;
+    if (circuit.size() == 1) return circuit;
+    // the last node repeats the first, so rotate over the edges and close the loop again
+    size_t edges = circuit.size() - 1, offset = it - circuit.begin();
+    for (size_t i = 0; i <= edges; i++)
+        result.push_back(circuit[(offset + i) % edges]);
+    return result;
+}
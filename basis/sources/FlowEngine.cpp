@@ -0,0 +1,245 @@
+#include "basis/headers/FlowEngine.h"
+#include <algorithm>
+#include <climits>
+
+using namespace GraphType;
+
+namespace {
+
+    // Arcs of node v are [offsets[v], offsets[v + 1]); arc a runs to head[a] and reverse[a] runs back.
+    struct Residual {
+        int n;
+        std::vector<int> offsets, head, reverse, forward;
+        std::vector<long long> cap, initial;
+
+        explicit Residual(const CompactGraph &graph) : n(graph.countNodes()), offsets(n + 1, 0),
+                                                       forward(graph.countEdges(), -1) {
+            for (auto &edge: graph.edges())
+                if (edge.u != edge.v) {
+                    offsets[edge.u + 1]++;
+                    offsets[edge.v + 1]++;
+                }
+            for (int v = 0; v < n; v++)
+                offsets[v + 1] += offsets[v];
+            head.resize(offsets[n]);
+            reverse.resize(offsets[n]);
+            cap.resize(offsets[n]);
+            std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+            for (int e = 0; e < graph.countEdges(); e++) {
+                auto &edge = graph.edge(e);
+                if (edge.u == edge.v) continue;
+                int a = cursor[edge.u]++, b = cursor[edge.v]++;
+                head[a] = edge.v;
+                head[b] = edge.u;
+                reverse[a] = b;
+                reverse[b] = a;
+                cap[a] = std::max(edge.weight, 0);
+                cap[b] = graph.isDirected() ? 0 : cap[a];
+                forward[e] = a;
+            }
+            initial = cap;
+        }
+
+        void push(int arc, long long amount) {
+            cap[arc] -= amount;
+            cap[reverse[arc]] += amount;
+        }
+    };
+
+    FlowResult collect(const CompactGraph &graph, const Residual &residual, int source) {
+        FlowResult result;
+        result.sourceSide.assign(residual.n, 0);
+        result.sourceSide[source] = 1;
+        std::vector<int> queue(1, source);
+        for (size_t i = 0; i < queue.size(); i++) {
+            int v = queue[i];
+            for (int a = residual.offsets[v]; a < residual.offsets[v + 1]; a++)
+                if (residual.cap[a] > 0 && !result.sourceSide[residual.head[a]]) {
+                    result.sourceSide[residual.head[a]] = 1;
+                    queue.push_back(residual.head[a]);
+                }
+        }
+        for (int a = residual.offsets[source]; a < residual.offsets[source + 1]; a++)
+            result.value += residual.initial[a] - residual.cap[a];
+
+        result.flow.assign(graph.countEdges(), 0);
+        for (int e = 0; e < graph.countEdges(); e++) {
+            int a = residual.forward[e];
+            if (a == -1) continue;
+            int b = residual.reverse[a];
+            // the pair gave up (initial - cap) forwards and gained (cap - initial) backwards
+            result.flow[e] = (residual.initial[a] - residual.cap[a] + residual.cap[b] - residual.initial[b]) / 2;
+            auto &edge = graph.edge(e);
+            bool out = result.sourceSide[edge.u] && !result.sourceSide[edge.v];
+            bool in = !result.sourceSide[edge.u] && result.sourceSide[edge.v];
+            if (out || (in && !graph.isDirected()))
+                result.cut.push_back(e);
+        }
+        return result;
+    }
+}
+
+FlowResult FlowEngine::dinic(const CompactGraph &graph, int source, int sink) {
+    Residual residual(graph);
+    int n = residual.n;
+    std::vector<int> level(n), cur(n), queue, path;
+    queue.reserve(n);
+    while (source != sink) {
+        std::fill(level.begin(), level.end(), -1);
+        level[source] = 0;
+        queue.assign(1, source);
+        for (size_t i = 0; i < queue.size() && level[sink] == -1; i++) {
+            int v = queue[i];
+            for (int a = residual.offsets[v]; a < residual.offsets[v + 1]; a++)
+                if (residual.cap[a] > 0 && level[residual.head[a]] == -1) {
+                    level[residual.head[a]] = level[v] + 1;
+                    queue.push_back(residual.head[a]);
+                }
+        }
+        if (level[sink] == -1) break;
+        std::copy(residual.offsets.begin(), residual.offsets.end() - 1, cur.begin());
+
+        path.clear();
+        int v = source;
+        while (true) {
+            if (v == sink) {
+                long long amount = LLONG_MAX;
+                for (int a: path)
+                    amount = std::min(amount, residual.cap[a]);
+                size_t saturated = path.size();
+                for (size_t i = 0; i < path.size(); i++) {
+                    residual.push(path[i], amount);
+                    if (residual.cap[path[i]] == 0 && saturated == path.size())
+                        saturated = i;
+                }
+                // resume from the tail of the first arc the augmentation saturated
+                path.resize(saturated);
+                v = path.empty() ? source : residual.head[path.back()];
+                continue;
+            }
+            int &a = cur[v];
+            while (a < residual.offsets[v + 1] &&
+                   (residual.cap[a] == 0 || level[residual.head[a]] != level[v] + 1))
+                a++;
+            if (a < residual.offsets[v + 1]) {
+                path.push_back(a);
+                v = residual.head[a];
+                continue;
+            }
+            // dead end: no arc of v leads on towards the sink in this phase
+            level[v] = -1;
+            if (path.empty()) break;
+            v = residual.head[residual.reverse[path.back()]];
+            path.pop_back();
+        }
+    }
+    return collect(graph, residual, source);
+}
+
+FlowResult FlowEngine::pushRelabel(const CompactGraph &graph, int source, int sink) {
+    Residual residual(graph);
+    int n = residual.n;
+    if (source == sink) return collect(graph, residual, source);
+
+    std::vector<int> height(n, 0), cur(n), queue;
+    std::vector<long long> excess(n, 0);
+    std::vector<std::vector<int>> buckets(2 * n + 1);
+    int top_low = -1, top_high = -1;
+    queue.reserve(n);
+
+    auto activate = [&](int v) {
+        buckets[height[v]].push_back(v);
+        if (height[v] < n)
+            top_low = std::max(top_low, height[v]);
+        else
+            top_high = std::max(top_high, height[v]);
+    };
+
+    // exact distances to the sink along residual arcs, or n plus the distance back to the source
+    auto global_relabel = [&]() {
+        std::fill(height.begin(), height.end(), 2 * n);
+        height[sink] = 0;
+        height[source] = n;
+        for (int root: {sink, source}) {
+            queue.assign(1, root);
+            for (size_t i = 0; i < queue.size(); i++) {
+                int y = queue[i];
+                for (int a = residual.offsets[y]; a < residual.offsets[y + 1]; a++) {
+                    int x = residual.head[a];
+                    if (height[x] == 2 * n && residual.cap[residual.reverse[a]] > 0) {
+                        height[x] = height[y] + 1;
+                        queue.push_back(x);
+                    }
+                }
+            }
+        }
+        for (auto &bucket: buckets)
+            bucket.clear();
+        top_low = top_high = -1;
+        for (int v = 0; v < n; v++) {
+            cur[v] = residual.offsets[v];
+            if (excess[v] > 0 && v != source && v != sink && height[v] < 2 * n)
+                activate(v);
+        }
+    };
+
+    for (int a = residual.offsets[source]; a < residual.offsets[source + 1]; a++) {
+        long long amount = residual.cap[a];
+        if (amount == 0) continue;
+        residual.push(a, amount);
+        excess[residual.head[a]] += amount;
+        excess[source] -= amount;
+    }
+    global_relabel();
+
+    long long work = 0, work_limit = 6LL * n + (long long) residual.head.size();
+    while (true) {
+        while (top_low >= 0 && buckets[top_low].empty())
+            top_low--;
+        int v;
+        if (top_low >= 0)
+            v = buckets[top_low].back(), buckets[top_low].pop_back();
+        else {
+            while (top_high >= 0 && buckets[top_high].empty())
+                top_high--;
+            if (top_high < 0) break;
+            v = buckets[top_high].back(), buckets[top_high].pop_back();
+        }
+
+        while (excess[v] > 0) {
+            int &a = cur[v];
+            if (a == residual.offsets[v + 1]) {
+                int lowest = 2 * n;
+                for (int b = residual.offsets[v]; b < residual.offsets[v + 1]; b++)
+                    if (residual.cap[b] > 0)
+                        lowest = std::min(lowest, height[residual.head[b]] + 1);
+                height[v] = std::min(lowest, 2 * n);
+                a = residual.offsets[v];
+                work += residual.offsets[v + 1] - residual.offsets[v] + 12;
+                if (height[v] == 2 * n) break;
+                continue;
+            }
+            int w = residual.head[a];
+            if (residual.cap[a] > 0 && height[v] == height[w] + 1) {
+                long long amount = std::min(excess[v], residual.cap[a]);
+                residual.push(a, amount);
+                excess[v] -= amount;
+                if (excess[w] == 0 && w != source && w != sink) {
+                    excess[w] += amount;
+                    activate(w);
+                } else
+                    excess[w] += amount;
+            } else
+                a++;
+        }
+        if (work > work_limit) {
+            global_relabel();
+            work = 0;
+        }
+    }
+    return collect(graph, residual, source);
+}
+
+FlowResult FlowEngine::maxFlow(const CompactGraph &graph, int source, int sink, FlowAlgorithm algorithm) {
+    return algorithm == Dinic ? dinic(graph, source, sink) : pushRelabel(graph, source, sink);
+}
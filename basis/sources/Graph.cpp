@@ -2,6 +2,7 @@
 #include <iomanip>
 #include <cmath>
 #include <algorithm>
+#include <atomic>
 #include "utils/random.h"
 
 using namespace GraphType;
@@ -10,10 +11,16 @@ Graph::Graph(int node_num, bool directed, bool weighted) :
         _directed(directed),
         _weighted(weighted),
         _invalidValue(_calcInvalid(directed, weighted)),
-        _weightRange(_calcWeightRange(weighted)) {
+        _weightRange(_calcWeightRange(weighted)),
+        _revision(_nextRevision()) {
     _init(node_num);
 }
 
+unsigned long long Graph::_nextRevision() {
+    static std::atomic<unsigned long long> counter(0);
+    return ++counter;
+}
+
 void Graph::_init(int node_num) {
     this->clear();
     if (node_num <= 0) return;
@@ -29,7 +36,9 @@ Graph::Graph(const Graph &obj) :
         _directed(obj._directed),
         _weighted(obj._weighted),
         _invalidValue(obj._invalidValue),
-        _weightRange(obj._weightRange) {
+        _weightRange(obj._weightRange),
+        _revision(_nextRevision()),
+        _trackComponents(obj._trackComponents) {
     this->clear();
     for (auto &node: obj.nodeList())
         this->addNode(node->name());
@@ -42,6 +51,43 @@ void Graph::clear() {
     this->_nodeSet.clear();
     this->_edgeSet.clear();
     this->_cachedNodeList.clear();
+    this->_components.reset(0);
+    this->_componentIds.clear();
+    this->_componentsStale = false;
+    _touch();
+}
+
+void Graph::trackComponents(bool enabled) {
+    this->_trackComponents = enabled;
+    this->_componentsStale = true;
+    if (!enabled) {
+        this->_components.reset(0);
+        this->_componentIds.clear();
+    }
+}
+
+void Graph::_buildComponents(UnionFind &sets, std::unordered_map<const Node *, int> &ids) const {
+    sets.reset(countNodes());
+    ids.clear();
+    int id = 0;
+    for (auto node: this->_cachedNodeList)
+        ids[node] = id++;
+    for (auto &edge: this->_edgeSet)
+        sets.unite(ids[edge.first.first], ids[edge.first.second]);
+}
+
+int Graph::countComponents() const {
+    if (!this->_trackComponents) {
+        UnionFind sets;
+        std::unordered_map<const Node *, int> ids;
+        _buildComponents(sets, ids);
+        return sets.countSets();
+    }
+    if (this->_componentsStale) {
+        _buildComponents(this->_components, this->_componentIds);
+        this->_componentsStale = false;
+    }
+    return this->_components.countSets();
 }
 
 Graph Graph::readFromFile(const std::string &file) {
@@ -96,6 +142,9 @@ bool Graph::addNode(const Node &_node) {
     if (hasNode(_node.name())) return false;
     _nodeSet.insert(_node);
     _cachedNodeList.emplace_back(node(_node.name()));
+    if (_trackComponents && !_componentsStale)
+        _componentIds[_cachedNodeList.back()] = _components.add();
+    _touch();
     return true;
 }
 
@@ -118,8 +167,10 @@ bool Graph::removeNode(Node *node) {
     if (!hasNode(node))
         return false;
     isolateNode(node);
+    _componentsStale = true;
     _nodeSet.erase(*node);
     _cachedNodeList.remove(node);
+    _touch();
     return true;
 }
 
@@ -202,7 +253,10 @@ bool Graph::setEdge(Node *u, Node *v, int w) {
             u->incUndirDegree();
             v->incUndirDegree();
         }
+        if (_trackComponents && !_componentsStale)
+            _components.unite(_componentIds[u], _componentIds[v]);
     }
+    _touch();
     return true;
 }
 
@@ -219,6 +273,7 @@ bool Graph::removeEdge(Node *u, Node *v) {
         return false;
     if (hasDirectedEdge(u, v)) {
         _edgeSet.erase({u, v});
+        _componentsStale = true;
         if (_directed) {
             u->decNegDegree();
             v->decPosDegree();
@@ -226,11 +281,14 @@ bool Graph::removeEdge(Node *u, Node *v) {
             u->decUndirDegree();
             v->decUndirDegree();
         }
+        _touch();
         return true;
     } else if (!_directed && hasDirectedEdge(v, u)) {
         _edgeSet.erase({v, u});
+        _componentsStale = true;
         u->decUndirDegree();
         v->decUndirDegree();
+        _touch();
     }
     return false;
 }
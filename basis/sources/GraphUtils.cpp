@@ -1,9 +1,65 @@
 #include "basis/headers/GraphUtils.h"
+#include "basis/headers/CompactGraph.h"
+#include "basis/headers/SpanningTreeEngine.h"
+#include "basis/headers/ComponentEngine.h"
+#include "basis/headers/BiconnectivityEngine.h"
+#include "basis/headers/HamiltonianEngine.h"
+#include "basis/headers/EulerianEngine.h"
+#include "basis/headers/TopologicalEngine.h"
+#include "basis/headers/ColoringEngine.h"
+#include "basis/headers/ChromaticEngine.h"
+#include "basis/headers/SmallGraph.h"
+#include "basis/headers/CliqueEngine.h"
+#include "basis/headers/ReachabilityEngine.h"
+#include "basis/headers/MinCutEngine.h"
+#include "basis/headers/MatchingEngine.h"
+#include "basis/headers/CentralityEngine.h"
+#include "basis/headers/TriangleEngine.h"
+#include "basis/headers/CoreEngine.h"
+#include "basis/headers/CommunityEngine.h"
+#include "basis/headers/DistanceEngine.h"
+#include "utils/revisioncache.h"
+#include "utils/unionfind.h"
+#include <algorithm>
+#include <memory>
 #include <unordered_map>
 #include <utility>
 #include <QString>
 #include <QDebug>
 
+// CompactGraph of the graph's current revision, shared by consecutive queries on an unchanged graph
+std::shared_ptr<const CompactGraph> snapshot(const Graph *graph) {
+    static RevisionCache<std::shared_ptr<const CompactGraph>> cache;
+    return cache.get(graph, [&]() { return std::make_shared<const CompactGraph>(*graph); });
+}
+
+RevisionCache<ComponentLabels> &strongComponentsCache() {
+    static RevisionCache<ComponentLabels> cache;
+    return cache;
+}
+
+const ComponentLabels &cachedStrongComponents(const Graph *graph) {
+    return strongComponentsCache().get(graph, [&]() {
+        return ComponentEngine::stronglyConnected(*snapshot(graph));
+    });
+}
+
+// The first reachability query on a revision is answered by a bidirectional search; the index is
+// only built once a second query shows the graph is being asked about repeatedly.
+struct ReachabilityState {
+    int queries = 0;
+    std::unique_ptr<ReachabilityIndex> index;
+};
+
+const ReachabilityIndex *cachedReachability(const Graph *graph, bool build) {
+    static RevisionCache<ReachabilityState> cache;
+    auto &state = cache.get(graph, []() { return ReachabilityState(); });
+    if (!state.index && (build || ++state.queries > 1))
+        state.index.reset(new ReachabilityIndex(
+                ReachabilityEngine::build(*snapshot(graph), cachedStrongComponents(graph))));
+    return state.index.get();
+}
+
 std::list<std::pair<std::string, std::string>> GraphUtils::BFSToDemo(const Graph *graph, const std::string &source) {
     std::list<std::pair<std::string, std::string>> result;
     if (!graph->hasNode(source)) return result;
@@ -98,25 +154,6 @@ void GraphUtils::DFSUtil(const Graph *graph, const std::string &vname, std::unor
     }
 }
 
-void UndirectedDFSUtil(const Graph *graph, const std::string &vname, std::unordered_map<std::string, bool> &visited,
-                       std::list<std::string> &steps) {
-    visited[vname] = true;
-    steps.push_back(vname);
-    for (auto &adj: graph->nodeList()) {
-        if ((graph->hasEdge(vname, adj->name()) || graph->hasEdge(adj->name(), vname)) && !visited[adj->name()])
-            UndirectedDFSUtil(graph, adj->name(), visited, steps);
-    }
-}
-
-int DFSCount(const Graph &graph, const std::string &uname, std::unordered_map<std::string, bool> &visited) {
-    visited[uname] = true;
-    int count = 1;
-    for (auto v: graph.nodeList())
-        if (graph.hasEdge(uname, v->name()) && !visited[v->name()])
-            count += DFSCount(graph, v->name(), visited);
-    return count;
-}
-
 std::list<std::string> GraphUtils::DFS(const Graph *graph, std::string source) {
     auto nodes = graph->nodeList();
     if (source.empty())
@@ -130,48 +167,38 @@ std::list<std::string> GraphUtils::DFS(const Graph *graph, std::string source) {
 
 bool GraphUtils::isConnectedFromUtoV(const Graph *graph, const std::string &uname, const std::string &vname) {
     if (!graph->hasNode(uname) || !graph->hasNode(vname)) return false;
-    std::unordered_map<std::string, bool> visited;
-    std::list<std::string> steps;
-    DFSUtil(graph, uname, visited, steps);
-    return visited[vname];
+    auto compact = snapshot(graph);
+    int u = compact->id(uname), v = compact->id(vname);
+    if (auto index = cachedReachability(graph, false))
+        return index->reaches(u, v);
+    bool connected = false;
+    if (withSmallGraph(*compact, [&](const auto &small) { connected = small.reachable(u)[v]; }))
+        return connected;
+    return ReachabilityEngine::bidirectionalSearch(*compact, u, v);
+}
+
+std::vector<bool> GraphUtils::areConnected(const Graph *graph,
+                                           const std::vector<std::pair<std::string, std::string>> &queries) {
+    std::vector<bool> result(queries.size(), false);
+    if (queries.empty()) return result;
+    auto compact = snapshot(graph);
+    auto index = cachedReachability(graph, true);
+    for (size_t i = 0; i < queries.size(); i++)
+        if (graph->hasNode(queries[i].first) && graph->hasNode(queries[i].second))
+            result[i] = index->reaches(compact->id(queries[i].first), compact->id(queries[i].second));
+    return result;
 }
 
 bool GraphUtils::isAllStronglyConnected(const Graph *graph) {
-    auto nodes = graph->nodeList();
-    for (auto &node: nodes) {
-        std::unordered_map<std::string, bool> visited;
-        std::list<std::string> steps;
-        DFSUtil(graph, node->name(), visited, steps);
-        for (auto &v: nodes) {
-            if (!visited[v->name()])
-                return false;
-        }
-    }
-    return true;
+    if (auto labels = strongComponentsCache().find(graph))
+        return labels->count <= 1;
+    return ComponentEngine::isStronglyConnected(*snapshot(graph));
 }
 
 bool GraphUtils::isAllWeaklyConnected(const Graph *graph) {
-    auto nodes = graph->nodeList();
-    std::queue<std::string> q;
-    std::unordered_map<std::string, bool> visited;
-    q.push(nodes.front()->name());
-    visited[nodes.front()->name()] = true;
-
-    while (!q.empty()) {
-        auto vname = q.front();
-        q.pop();
-        for (auto &adj: nodes) {
-            if ((graph->hasEdge(vname, adj->name()) || graph->hasEdge(adj->name(), vname)) &&
-                !visited[adj->name()]) {
-                visited[adj->name()] = true;
-                q.push(adj->name());
-            }
-        }
-    }
-    for (auto &&i : visited)
-        if (!i.second)
-            return false;
-    return true;
+    if (graph->tracksComponents())
+        return graph->countComponents() <= 1;
+    return ComponentEngine::weaklyConnected(*snapshot(graph)).count <= 1;
 }
 
 std::string minDistance(std::unordered_map<std::string, int> &dist, std::unordered_map<std::string, bool> &sptSet) {
@@ -184,45 +211,61 @@ std::string minDistance(std::unordered_map<std::string, int> &dist, std::unorder
     return min_index;
 }
 
-std::list<std::string> GraphUtils::Dijkstra(const Graph *graph, const std::string &start, const std::string &goal) {
+std::list<std::string> GraphUtils::Dijkstra(const Graph *graph, const std::string &start, const std::string &goal,
+                                            ShortestPathBackend backend) {
     if (!graph->hasNode(start) || !graph->hasNode(goal))
         return std::list<std::string>();
-    auto nodes = graph->nodeList();
-    std::unordered_map<std::string, int> dist;
-    for (auto &node: nodes)
-        dist[node->name()] = INT_MAX;
+    auto compact = snapshot(graph);
+    int source = compact->id(start), target = compact->id(goal);
+    auto tree = backend == ShortestPathBackend::DeltaStepping
+                ? ShortestPathEngine::deltaStepping(*compact, source)
+                : ShortestPathEngine::dijkstra(*compact, source, target);
 
-    std::unordered_map<std::string, bool> sptSet;
-    std::unordered_map<std::string, std::string> parent;
-    dist[start] = 0;
-    for (int count = 0; count < graph->countNodes() - 1; count++) {
-        auto uname = minDistance(dist, sptSet);
-        sptSet[uname] = true;
-        for (auto &v: nodes) {
-            if (!sptSet[v->name()] && graph->hasEdge(uname, v->name()) && dist[uname] != INT_MAX &&
-                dist[uname] + graph->weight(uname, v->name()) < dist[v->name()]) {
-                dist[v->name()] = dist[uname] + graph->weight(uname, v->name());
-                parent[v->name()] = uname;
-            }
-        }
-    }
     std::list<std::string> path;
     std::cout << "Dijkstra: shortest path from " << start << " to " << goal << ": ";
-    if (dist[goal] == INT_MAX) {
+    if (!tree.reached(target)) {
         std::cout << " not found!\n";
         return path;
     }
-    auto curr = goal;
-    while (!curr.empty()) {
-        path.push_front(curr);
-        curr = parent[curr];
-    }
+    for (int v = target; v != -1; v = tree.parent[v])
+        path.push_front(compact->name(v));
     for (auto &nodeName: path)
         std::cout << nodeName << " ";
-    std::cout << " ------------ cost = " << dist[goal];
+    std::cout << " ------------ cost = " << tree.dist[target];
     return path;
 }
 
+std::list<std::pair<std::string, long long>>
+GraphUtils::shortestDistances(const Graph *graph, const std::string &source, ShortestPathBackend backend) {
+    std::list<std::pair<std::string, long long>> result;
+    if (!graph->hasNode(source)) return result;
+    auto compact = snapshot(graph);
+    auto tree = ShortestPathEngine::run(*compact, compact->id(source), backend);
+    for (int v = 0; v < compact->countNodes(); v++)
+        if (tree.reached(v))
+            result.emplace_back(compact->name(v), tree.dist[v]);
+    return result;
+}
+
+std::list<std::pair<std::string, double>>
+GraphUtils::displayShortestDistances(const Graph *graph, const std::string &source) {
+    std::list<std::pair<std::string, double>> result;
+    auto distances = shortestDistances(graph, source);
+    if (distances.empty()) return result;
+    long long farthest = 0;
+    for (auto &it: distances)
+        farthest = std::max(farthest, it.second);
+    std::cout << "Shortest distances from " << source << ":\n";
+    for (auto &it: distances) {
+        std::cout << it.first << " \t " << it.second << "\n";
+        result.emplace_back(it.first, (double) (farthest - it.second));
+    }
+    long long unreached = graph->countNodes() - (long long) distances.size();
+    if (unreached > 0)
+        std::cout << unreached << " node(s) not reachable\n";
+    return result;
+}
+
 #include <cmath>
 
 int euclideanDist(QPointF p1, QPointF p2) {
@@ -276,67 +319,18 @@ std::list<std::string> GraphUtils::AStar(const Graph *graph, std::string start,
     return path;
 }
 
-std::string minKey(std::unordered_map<std::string, int> &key, std::unordered_map<std::string, bool> &mstSet) {
-    int min = INT_MAX;
-    std::string min_index;
-    for (auto &it: key) {
-        if (!mstSet[it.first] && it.second < min) {
-            min = it.second;
-            min_index = it.first;
-        }
-    }
-    return min_index;
-}
-
-std::list<std::pair<std::string, std::string>>
-PrimUtil(const Graph *graph, const std::string &source, bool &full, int &cost) {
-    std::list<std::pair<std::string, std::string>> result;
-    if (!graph->hasNode(source)) return result;
-    std::unordered_map<std::string, std::string> parent;
-    std::unordered_map<std::string, int> key;
-    auto nodes = graph->nodeList();
-    for (auto &node: nodes)
-        key[node->name()] = INT_MAX;
-    std::unordered_map<std::string, bool> mstSet;
-
-    key[source] = 0;
-    parent[source] = "";
-    cost = 0;
-    for (int count = 0; count < graph->countNodes(); count++) {
-        auto u = minKey(key, mstSet);
-        mstSet[u] = true;
-        for (auto &node: nodes) {
-            auto v = node->name();
-            if (!mstSet[v]
-                && graph->hasEdge(u, v)
-                && graph->weight(u, v) < key[v]) {
-                key[v] = graph->weight(u, v);
-                parent[v] = u;
-                result.emplace_back(std::make_pair(u, v));
-                cost += graph->weight(u, v);
-            }
-        }
-    }
-    full = true;
-    if (!result.empty()) {
-        for (auto node: nodes) {
-            if (node->name() != source && parent[node->name()].empty())
-                full = false;
-        }
-    } else
-        full = false;
-    return result;
-}
-
 void
 printMST(const Graph &graph, const std::list<std::pair<std::string, std::string>> &result, const std::string &source,
-         int cost) {
+         long long cost) {
     if (result.empty()) {
         std::cout << "Not found minimum spanning tree" << (source.empty() ? " for the whole graph" : " from source = ")
                   << source << "\n";
         return;
     }
-    std::cout << "Minimum spanning tree (source = " << source << "): " << std::endl;
+    if (source.empty())
+        std::cout << "Minimum spanning tree: " << std::endl;
+    else
+        std::cout << "Minimum spanning tree (source = " << source << "): " << std::endl;
     std::cout << "vertex \t parent \t cost:" << std::endl;
 
     for (const auto &it: result) {
@@ -346,176 +340,149 @@ printMST(const Graph &graph, const std::list<std::pair<std::string, std::string>
     std::cout << "total cost: " << cost << "\n";
 }
 
+std::list<std::pair<std::string, std::string>>
+forestToPairs(const CompactGraph &compact, const SpanningForest &forest, int source = -1) {
+    std::list<std::pair<std::string, std::string>> result;
+    std::vector<bool> inTree(compact.countNodes(), false);
+    if (source >= 0) inTree[source] = true;
+    for (int e: forest.edges) {
+        auto &edge = compact.edge(e);
+        if (source >= 0 && !inTree[edge.u]) {
+            result.emplace_back(compact.name(edge.v), compact.name(edge.u));
+            inTree[edge.u] = true;
+        } else {
+            result.emplace_back(compact.name(edge.u), compact.name(edge.v));
+            inTree[edge.v] = true;
+        }
+    }
+    return result;
+}
+
+// Forest edges grouped by tree, trees in order of their lowest node id; isolated nodes have none
+std::list<std::list<std::pair<std::string, std::string>>>
+forestTrees(const CompactGraph &compact, const SpanningForest &forest) {
+    UnionFind trees(compact.countNodes());
+    for (int e: forest.edges)
+        trees.unite(compact.edge(e).u, compact.edge(e).v);
+    std::unordered_map<int, std::list<std::pair<std::string, std::string>>> grouped;
+    for (int e: forest.edges) {
+        auto &edge = compact.edge(e);
+        grouped[trees.find(edge.u)].emplace_back(compact.name(edge.u), compact.name(edge.v));
+    }
+    std::list<std::list<std::pair<std::string, std::string>>> result;
+    for (int v = 0; v < compact.countNodes(); v++) {
+        auto tree = grouped.find(trees.find(v));
+        if (tree != grouped.end()) {
+            result.push_back(std::move(tree->second));
+            grouped.erase(tree);
+        }
+    }
+    return result;
+}
+
 std::list<std::pair<std::string, std::string>> GraphUtils::Prim(const Graph *graph, std::string source) {
     std::list<std::pair<std::string, std::string>> result;
-    const auto nodes = graph->nodeList();
-    bool full{};
-    int min_cost = INT_MAX;
+    auto compact = snapshot(graph);
     if (source.empty()) {
-        if (!isAllWeaklyConnected(graph)) {
-            std::cout << "Minimum spanning tree: not found because the graph is not connected!";
+        auto forest = SpanningTreeEngine::minimumSpanningForest(*compact);
+        if (forest.isTree()) {
+            result = forestToPairs(*compact, forest);
+            printMST(*graph, result, source, forest.cost);
             return result;
         }
-        for (auto node: nodes) {
-            int cost;
-            auto res = PrimUtil(graph, node->name(), full, cost);
-            if (full && cost < min_cost) {
-                result = res;
-                min_cost = cost;
-                source = node->name();
-            }
+        std::cout << "The graph is not connected, minimum spanning forest of " << forest.components
+                  << " components:\n";
+        int tree = 0;
+        for (auto &edges: forestTrees(*compact, forest)) {
+            std::cout << "Tree " << ++tree << ":\n";
+            for (auto &edge: edges)
+                std::cout << edge.second << " \t " << edge.first << " \t " << graph->weight(edge.first, edge.second)
+                          << "\n";
+            result.insert(result.end(), edges.begin(), edges.end());
         }
-        printMST(*graph, result, source, min_cost);
+        if (tree < forest.components)
+            std::cout << forest.components - tree << " isolated node(s)\n";
+        std::cout << "total cost: " << forest.cost << "\n";
         return result;
     }
-    result = PrimUtil(graph, source, full, min_cost);
-    printMST(*graph, result, source, min_cost);
+    if (!graph->hasNode(source)) return result;
+    auto forest = SpanningTreeEngine::prim(*compact, compact->id(source));
+    result = forestToPairs(*compact, forest, compact->id(source));
+    printMST(*graph, result, source, forest.cost);
     return result;
 }
 
-void weaklyFillOrder(const Graph *graph, const std::string &vname, std::unordered_map<std::string, bool> &visited,
-                     std::stack<std::string> &stack) {
-    visited[vname] = true;
-    auto nodes = graph->nodeList();
-    for (auto &node: nodes)
-        if (!visited[node->name()] && (graph->hasEdge(vname, node->name()) ||
-                                       graph->hasEdge(vname, node->name())))
-            weaklyFillOrder(graph, node->name(), visited, stack);
-    stack.push(vname);
-}
-
-void stronglyFillOrder(const Graph *graph, const std::string &vname, std::unordered_map<std::string, bool> &visited,
-                       std::stack<std::string> &stack) {
-    visited[vname] = true;
-    auto nodes = graph->nodeList();
-    for (auto &node: nodes)
-        if (!visited[node->name()] && graph->hasEdge(vname, node->name()))
-            weaklyFillOrder(graph, node->name(), visited, stack);
-    stack.push(vname);
+std::list<std::list<std::pair<std::string, std::string>>> GraphUtils::minimumSpanningForest(const Graph *graph) {
+    auto compact = snapshot(graph);
+    return forestTrees(*compact, SpanningTreeEngine::minimumSpanningForest(*compact));
 }
 
 std::list<std::list<std::string>> GraphUtils::connectedComponents(const Graph *graph) {
     std::list<std::list<std::string>> result;
-    std::unordered_map<std::string, bool> visited;
-    std::stack<std::string> stack;
-
-    auto nodes = graph->nodeList();
-    for (auto &node: nodes)
-        if (!visited[node->name()])
-            stronglyFillOrder(graph, node->name(), visited, stack);
-
-    Graph gr = graph->transpose();
-    visited.clear();
-
-    while (!stack.empty()) {
-        auto vname = stack.top();
-        stack.pop();
-
-        if (!visited[vname]) {
-            std::list<std::string> steps;
-            DFSUtil(&gr, vname, visited, steps);
-            result.push_back(steps);
-        }
+    auto compact = snapshot(graph);
+    auto &labels = cachedStrongComponents(graph);
+    for (auto &group: labels.groups()) {
+        std::list<std::string> component;
+        for (int v: group)
+            component.push_back(compact->name(v));
+        result.push_back(component);
     }
     return result;
 }
 
 std::list<std::list<std::string>> GraphUtils::weaklyConnectedComponents(const Graph *graph) {
     std::list<std::list<std::string>> result;
-    std::unordered_map<std::string, bool> visited;
-    auto nodes = graph->nodeList();
-    for (auto &node: nodes) {
-        if (!visited[node->name()]) {
-            std::list<std::string> component;
-            UndirectedDFSUtil(graph, node->name(), visited, component);
-            result.push_back(component);
-        }
+    auto compact = snapshot(graph);
+    auto labels = ComponentEngine::weaklyConnected(*compact);
+    for (auto &group: labels.groups()) {
+        std::list<std::string> component;
+        for (int v: group)
+            component.push_back(compact->name(v));
+        result.push_back(component);
     }
     return result;
 }
 
-void bridgeUtil(const Graph *graph, const std::string &uname,
-                std::unordered_map<std::string, bool> &visited,
-                std::unordered_map<std::string, int> &disc,
-                std::unordered_map<std::string, int> &low,
-                std::unordered_map<std::string, std::string> &parent,
-                std::list<std::pair<std::string, std::string>> &res, int &time) {
-
-    visited[uname] = true;
-    disc[uname] = low[uname] = ++time;
-    auto nodes = graph->nodeList();
-    for (auto &v: nodes) {
-        if (!visited[v->name()] && graph->hasEdge(uname, v->name())) {
-            parent[v->name()] = uname;
-            bridgeUtil(graph, v->name(), visited, disc, low, parent, res, time);
-            low[uname] = std::min(low[uname], low[v->name()]);
-            if (low[v->name()] > disc[uname]) {
-                res.emplace_back(uname, v->name());
-            }
-        } else if (v->name() != parent[uname] && graph->hasEdge(uname, v->name()))
-            low[uname] = std::min(low[uname], disc[v->name()]);
-    }
-}
-
-std::list<std::pair<std::string, std::string>> GraphUtils::getBridges(const Graph *graph) {
-    std::unordered_map<std::string, bool> visited;
-    std::unordered_map<std::string, int> disc;
-    std::unordered_map<std::string, int> low;
-    std::unordered_map<std::string, std::string> parent;
-    std::list<std::pair<std::string, std::string>> result;
-
-    int time = 0;
-    auto nodes = graph->nodeList();
-    for (auto &v: nodes) {
-        if (!visited[v->name()])
-            bridgeUtil(graph, v->name(), visited, disc, low, parent, result, time);
+struct BiconnectivityNames {
+    std::list<std::pair<std::string, std::string>> bridges;
+    std::list<std::string> articulationNodes;
+    std::list<std::list<std::pair<std::string, std::string>>> blocks;
+};
+
+BiconnectivityNames biconnectivityNames(const CompactGraph &compact) {
+    auto analysis = BiconnectivityEngine::analyze(compact);
+    auto edgePair = [&compact](int e) {
+        return std::make_pair(compact.name(compact.edge(e).u), compact.name(compact.edge(e).v));
+    };
+    BiconnectivityNames result;
+    for (int e: analysis.bridges)
+        result.bridges.push_back(edgePair(e));
+    for (int v: analysis.articulationNodes)
+        result.articulationNodes.push_back(compact.name(v));
+    for (auto &block: analysis.blocks) {
+        std::list<std::pair<std::string, std::string>> edges;
+        for (int e: block)
+            edges.push_back(edgePair(e));
+        result.blocks.push_back(edges);
     }
     return result;
 }
 
-void APUtil(const Graph *graph, const std::string &uname,
-            std::unordered_map<std::string, bool> &visited,
-            std::unordered_map<std::string, int> &disc,
-            std::unordered_map<std::string, int> &low,
-            std::unordered_map<std::string, std::string> &parent,
-            std::list<std::string> &ap) {
-
-    static int time = 0;
-    int children = 0;
-    visited[uname] = true;
-
-    disc[uname] = low[uname] = ++time;
-
-    for (auto &v: graph->nodeList()) {
-        if (graph->hasEdge(uname, v->name())) {
-            if (!visited[v->name()]) {
-                children++;
-                parent[v->name()] = uname;
-                APUtil(graph, v->name(), visited, disc, low, parent, ap);
-
-                low[uname] = std::min(low[uname], low[v->name()]);
-                if (parent[uname].empty() && children > 1)
-                    ap.push_front(uname);
+const BiconnectivityNames &cachedBiconnectivity(const Graph *graph) {
+    static RevisionCache<BiconnectivityNames> cache;
+    return cache.get(graph, [&]() { return biconnectivityNames(*snapshot(graph)); });
+}
 
-                if (!parent[uname].empty() && low[v->name()] >= disc[uname])
-                    ap.push_front(uname);
-            } else if (v->name() != parent[uname])
-                low[uname] = std::min(low[uname], disc[v->name()]);
-        }
-    }
+std::list<std::pair<std::string, std::string>> GraphUtils::getBridges(const Graph *graph) {
+    return cachedBiconnectivity(graph).bridges;
 }
 
 std::list<std::string> GraphUtils::getArticulationNodes(const Graph *graph) {
-    std::unordered_map<std::string, bool> visited;
-    std::unordered_map<std::string, int> disc;
-    std::unordered_map<std::string, int> low;
-    std::unordered_map<std::string, std::string> parent;
-    std::list<std::string> ap;
+    return cachedBiconnectivity(graph).articulationNodes;
+}
 
-    for (auto &node: graph->nodeList())
-        if (!visited[node->name()])
-            APUtil(graph, node->name(), visited, disc, low, parent, ap);
-    return ap;
+std::list<std::list<std::pair<std::string, std::string>>> GraphUtils::getBiconnectedComponents(const Graph *graph) {
+    return cachedBiconnectivity(graph).blocks;
 }
 
 std::list<std::string> GraphUtils::displayArticulationNodes(const Graph *graph) {
@@ -557,45 +524,24 @@ std::list<std::list<std::string>> GraphUtils::displayConnectedComponents(const G
     return result;
 }
 
-bool isSafe(const Graph *graph, const std::string &vname,
-            std::vector<std::string> &path, int pos) {
-    if (!graph->hasEdge(path[pos - 1], vname))
-        return false;
-    for (int i = 0; i < pos; i++)
-        if (path[i] == vname)
-            return false;
-    return true;
-}
-
-bool hamCycleUtil(const Graph *graph, std::vector<std::string> &path, int pos) {
-    int n = graph->countNodes();
-    if (pos == n)
-        return graph->hasEdge(path[pos - 1], path[0]);
-
-    for (auto &v: graph->nodeList()) {
-        if (v->name() != path[0] && isSafe(graph, v->name(), path, pos)) {
-            path[pos] = v->name();
-            if (hamCycleUtil(graph, path, pos + 1))
-                return true;
-            path[pos] = "";
-        }
-    }
-    return false;
+std::list<std::string> rotateCycle(const CompactGraph &compact, const std::vector<int> &cycle, int source) {
+    std::list<std::string> result;
+    auto start = std::find(cycle.begin(), cycle.end(), source);
+    if (start == cycle.end()) return result;
+    for (size_t i = 0; i <= cycle.size(); i++)
+        result.push_back(compact.name(cycle[(start - cycle.begin() + i) % cycle.size()]));
+    return result;
 }
 
 std::list<std::string> GraphUtils::getHamiltonianCycle(const Graph *graph, std::string source) {
     auto nodes = graph->nodeList();
     if (source.empty())
         source = nodes.front()->name();
-    std::vector<std::string> path(graph->countNodes(), "");
-    std::list<std::string> result;
-    path[0] = source;
-    if (!hamCycleUtil(graph, path, 1))
-        return result;
-    for (int i = 0; i < graph->countNodes(); i++)
-        result.push_back(path[i]);
-    result.push_back(path[0]);
-    return result;
+    if (!graph->hasNode(source))
+        return std::list<std::string>();
+    auto compact = snapshot(graph);
+    auto found = HamiltonianEngine::findCycle(*compact);
+    return rotateCycle(*compact, found.cycle, compact->id(source));
 }
 
 std::list<std::list<std::string>> GraphUtils::displayHamiltonianCycle(const Graph *graph) {
@@ -605,15 +551,17 @@ std::list<std::list<std::string>> GraphUtils::displayHamiltonianCycle(const Grap
         std::cout << "|V| = " << graph->countNodes() << " < 3\n";
         return result;
     }
-    auto nodes = graph->nodeList();
-    for (auto &source: nodes) {
-        auto cycle = getHamiltonianCycle(graph, source->name());
-        if (cycle.empty())
-            continue;
-        else
-            result.push_back(cycle);
-
-        std::cout << "Hamiltonian Cycle (source = " << source->name() << "): ";
+    auto compact = snapshot(graph);
+    auto found = HamiltonianEngine::findCycle(*compact);
+    if (found.status == HamiltonianStatus::SearchTimedOut) {
+        std::cout << "Hamiltonian Cycle search ran out of time";
+        return result;
+    }
+    // a cycle from any other source is a rotation of the same cycle
+    for (int source = 0; source < compact->countNodes() && !found.cycle.empty(); source++) {
+        auto cycle = rotateCycle(*compact, found.cycle, source);
+        result.push_back(cycle);
+        std::cout << "Hamiltonian Cycle (source = " << compact->name(source) << "): ";
         for (auto &node: cycle)
             std::cout << node << " ";
         std::cout << "\n";
@@ -623,59 +571,39 @@ std::list<std::list<std::string>> GraphUtils::displayHamiltonianCycle(const Grap
     return result;
 }
 
-bool isBridge(Graph graph, const std::string &uname, const std::string &vname) {
-    if (uname == vname)
-        return false;
-    std::unordered_map<std::string, bool> visited;
-    int count1 = DFSCount(graph, uname, visited);
-    graph.removeEdge(uname, vname);
-    int count2 = DFSCount(graph, vname, visited);
-    return count1 <= count2;
-}
-
-std::list<std::string> GraphUtils::Hierholzer(Graph &graph, std::string source) {
+std::list<std::string> trailNames(const CompactGraph &compact, const std::vector<int> &trail) {
     std::list<std::string> result;
-    std::stack<std::string> curr_path;
-    std::vector<std::string> cycle;
-    auto curr_node = source;
-    curr_path.push(source);
-    while (!curr_path.empty()) {
-        int degree = graph.isDirected() ? graph.node(curr_node)->negDegree() : graph.node(curr_node)->undirDegree();
-        if (degree) {
-            curr_path.push(curr_node);
-            std::string next_node;
-            for (auto v: graph.nodeList()) {
-                if (graph.hasEdge(curr_node, v->name())) {
-                    next_node = v->name();
-                    break;
-                }
-            }
-            graph.removeEdge(curr_node, next_node);
-            curr_node = next_node;
-        }
-        else {
-            cycle.push_back(curr_node);
-            curr_node = curr_path.top();
-            curr_path.pop();
-        }
-    }
-    for (int i = cycle.size() - 1; i >= 0; --i)
-        result.push_back(cycle[i]);
+    for (int v: trail)
+        result.push_back(compact.name(v));
     return result;
 }
 
-std::list<std::string> GraphUtils::getEulerianCircuit(const Graph *_graph, std::string source) {
+std::list<std::string> GraphUtils::Hierholzer(const Graph &graph, std::string source) {
+    auto compact = snapshot(&graph);
+    if (compact->id(source) == -1)
+        return std::list<std::string>();
+    return trailNames(*compact, EulerianEngine::find(*compact, compact->id(source)).nodes);
+}
+
+std::list<std::string> GraphUtils::getEulerianCircuit(const Graph *graph, std::string source) {
     std::list<std::string> result;
-    Graph graph(*_graph);
-    if (source.empty())
-        source = graph.nodeList().front()->name();
-    if (!graph.hasNode(source))
+    if (source.empty() && graph->countNodes())
+        source = graph->nodeList().front()->name();
+    if (!graph->hasNode(source))
         return result;
-
-    result = Hierholzer(graph, source);
+    auto shared = snapshot(graph);
+    auto &compact = *shared;
+    auto trail = EulerianEngine::find(compact, compact.id(source));
+    if (trail.kind == ClosedTrail)
+        result = trailNames(compact, EulerianEngine::rotate(trail.nodes, compact.id(source)));
     return result;
 }
 
+std::list<std::string> GraphUtils::getEulerianPath(const Graph *graph) {
+    auto compact = snapshot(graph);
+    return trailNames(*compact, EulerianEngine::find(*compact).nodes);
+}
+
 std::list<std::list<std::string>>
 GraphUtils::displayEulerianCircuit(const Graph *graph) {
     std::list<std::list<std::string>> result;
@@ -692,130 +620,112 @@ GraphUtils::displayEulerianCircuit(const Graph *graph) {
         }
     }
 
-    for (auto &node: graph->nodeList()) {
-        auto cycle = getEulerianCircuit(graph, node->name());
-        std::cout << "Euler Circuit (source = " << node->name() << "): ";
+    auto shared = snapshot(graph);
+    auto &compact = *shared;
+    auto trail = EulerianEngine::find(compact);
+    if (trail.kind == OpenTrail) {
+        result.push_back(trailNames(compact, trail.nodes));
+        std::cout << "Eulerian Circuit not found, Euler Path: ";
+        for (auto &node: result.front())
+            std::cout << node << " ";
+        std::cout << "\n";
+        return result;
+    }
+    // every circuit through another source is a rotation of the one found
+    for (int source = 0; source < compact.countNodes(); source++) {
+        auto cycle = trailNames(compact, EulerianEngine::rotate(trail.nodes, source));
+        std::cout << "Euler Circuit (source = " << compact.name(source) << "): ";
         if (cycle.empty())
             std::cout << "not found!\n";
         else {
             result.emplace_back(cycle);
-            while (!cycle.empty()) {
-                std::cout << cycle.front() << " ";
-                cycle.pop_front();
-            }
+            for (auto &node: cycle)
+                std::cout << node << " ";
             std::cout << "\n";
         }
     }
     return result;
 }
 
-void topoSortUtil(const Graph *graph, const std::string &vname, std::unordered_map<std::string, bool> &visited,
-                  std::stack<std::string> &stack) {
-    visited[vname] = true;
-    for (auto &node: graph->nodeList())
-        if (graph->hasEdge(vname, node->name()) && !visited[node->name()])
-            topoSortUtil(graph, node->name(), visited, stack);
-    stack.push(vname);
-}
-
 bool GraphUtils::isCycle(const Graph *graph) {
-    std::queue<std::string> q;
-    std::unordered_map<std::string, int> in_degree;
-    for (auto node: graph->nodeList()) {
-        in_degree[node->name()] = node->posDegree();
-        if (in_degree[node->name()] == 0)
-            q.push(node->name());
-    }
-    int cnt = 0;
-    std::vector<std::string> top_order;
-    while (!q.empty()) {
-        auto u = q.front();
-        q.pop();
-        top_order.push_back(u);
-        for (auto v: graph->nodeList()) {
-            if (--in_degree[v->name()] == 0)
-                q.push(v->name());
-            cnt++;
-        }
-    }
-    return (cnt != graph->countNodes());
+    auto compact = snapshot(graph);
+    if (compact->isDirected())
+        return !TopologicalEngine::sort(*compact).isAcyclic();
+    UnionFind sets(compact->countNodes());
+    for (auto &edge: compact->edges())
+        if (!sets.unite(edge.u, edge.v))
+            return true;
+    return false;
 }
 
 std::list<std::string> GraphUtils::getTopoSortResult(const Graph *graph) {
-    if (!(graph->isDirected() && isCycle(graph))) {
+    if (!graph->isDirected()) {
         std::cout << "The graph is not DAG\n";
         return std::list<std::string>();
     }
-    std::unordered_map<std::string, bool> visited;
-    std::stack<std::string> stack;
-    for (auto &node: graph->nodeList())
-        if (!visited[node->name()])
-            topoSortUtil(graph, node->name(), visited, stack);
-
-    std::list<std::string> result;
-    while (!stack.empty()) {
-        result.push_back(stack.top());
-        stack.pop();
+    auto compact = snapshot(graph);
+    auto sorted = TopologicalEngine::sort(*compact);
+    if (!sorted.isAcyclic()) {
+        std::cout << "The graph is not DAG, cycle: ";
+        for (int v: sorted.cycle)
+            std::cout << compact->name(v) << " ";
+        std::cout << "\n";
+        return std::list<std::string>();
     }
+    return trailNames(*compact, sorted.order);
+}
+
+std::list<std::list<std::string>> GraphUtils::getTopoLevels(const Graph *graph) {
+    std::list<std::list<std::string>> result;
+    if (!graph->isDirected())
+        return result;
+    auto compact = snapshot(graph);
+    auto sorted = TopologicalEngine::sort(*compact);
+    if (sorted.isAcyclic())
+        for (auto &level: sorted.levels)
+            result.push_back(trailNames(*compact, level));
     return result;
 }
 
 std::list<std::string> GraphUtils::displayTopoSort(const Graph *graph) {
     std::list<std::string> topo_sorted;
-    if (graph->isDirected()) {
-        topo_sorted = getTopoSortResult(graph);
-        std::cout << "Topo sorted: ";
-        if (topo_sorted.empty()) {
-            std::cout << "not found!\n";
-            return topo_sorted;
-        }
-        for (const auto &v: topo_sorted)
-            std::cout << v << " ";
+    if (!graph->isDirected())
+        return topo_sorted;
+    // one sort gives both the order and its levels
+    auto compact = snapshot(graph);
+    auto sorted = TopologicalEngine::sort(*compact);
+    if (!sorted.isAcyclic()) {
+        std::cout << "The graph is not DAG, cycle: ";
+        for (int v: sorted.cycle)
+            std::cout << compact->name(v) << " ";
+        std::cout << "\nTopo sorted: not found!\n";
+        return topo_sorted;
+    }
+    topo_sorted = trailNames(*compact, sorted.order);
+    std::cout << "Topo sorted: ";
+    for (const auto &v: topo_sorted)
+        std::cout << v << " ";
+    std::cout << "\n";
+    for (size_t depth = 0; depth < sorted.levels.size(); depth++) {
+        std::cout << "Level " << depth << ": ";
+        for (int v: sorted.levels[depth])
+            std::cout << compact->name(v) << " ";
         std::cout << "\n";
     }
     return topo_sorted;
 }
 
-std::list<std::pair<std::string, int>> GraphUtils::getColoringResult(const Graph *graph, std::string source) {
+std::list<std::pair<std::string, int>>
+GraphUtils::getColoringResult(const Graph *graph, std::string source, ColoringStrategy strategy) {
     std::list<std::pair<std::string, int>> res_list;
     if (graph->isDirected())
         return res_list;
 
-    auto nodes = graph->nodeList();
-    if (source.empty())
-        source = nodes.front()->name();
-    std::unordered_map<int, bool> available; // available colors
-    std::unordered_map<std::string, int> result; // result: map of pairs { nodeName : _color }
-
-    for (auto &node: nodes)
-        result[node->name()] = -1;
-    result[source] = 0;
-    for (auto u: nodes) {
-        if (u->name() != source) {
-            for (auto v: nodes) {
-                if (graph->hasEdge(u->name(), v->name())) {
-                    if (result[v->name()] != -1)
-                        available[result[v->name()]] = true;
-                }
-            }
-            int cr;
-            for (cr = 0; cr < graph->countNodes(); cr++) {
-                if (!available[cr])
-                    break;
-            }
-            result[u->name()] = cr;
-            for (auto &v: nodes) {
-                if (graph->hasEdge(v->name(), v->name())) {
-                    if (result[v->name()] != -1)
-                        available[result[v->name()]] = false;
-                }
-            }
-        }
-    }
-    for (auto &node: nodes) // using for loop because it requires ordering from node 0th to node 0th and result map is unordered
-        res_list.emplace_back(std::make_pair(
-                node->name(),
-                result[node->name()]));
+    auto compact = snapshot(graph);
+    auto coloring = strategy == DSatur ? ColoringEngine::dsatur(*compact, compact->id(source))
+                                       : ColoringEngine::color(*compact, strategy);
+    for (int v = 0; v < compact->countNodes(); v++)
+        res_list.emplace_back(compact->name(v), coloring.color[v]);
     return res_list;
 }
 
@@ -824,7 +734,10 @@ std::list<std::pair<std::string, std::string>> GraphUtils::displayColoring(const
         return std::list<std::pair<std::string, std::string>>();
     auto result = getColoringResult(graph, std::move(source));
     std::list<std::pair<std::string, std::string>> resultToSent;
-    std::cout << "Coloring of the graph: " << std::endl;
+    int colors = 0;
+    for (auto &it: result)
+        colors = std::max(colors, it.second + 1);
+    std::cout << "Coloring of the graph (" << colors << " colors): " << std::endl;
     for (auto &it: result) {
         std::cout << "Node " << it.first << " ---> Color " << it.second << std::endl;
         resultToSent.emplace_back(it.first, std::to_string(it.second));
@@ -832,6 +745,608 @@ std::list<std::pair<std::string, std::string>> GraphUtils::displayColoring(const
     return resultToSent;
 }
 
+std::list<std::pair<std::string, std::string>> GraphUtils::displayChromaticNumber(const Graph *graph, int time_limit_ms) {
+    std::list<std::pair<std::string, std::string>> resultToSent;
+    if (graph->isDirected())
+        return resultToSent;
+    auto compact = snapshot(graph);
+    auto result = ChromaticEngine::solve(*compact, time_limit_ms);
+    if (result.optimal)
+        std::cout << "Chromatic number: " << result.coloring.count << std::endl;
+    else if (compact->countNodes() > ChromaticEngine::exactLimit)
+        std::cout << "Chromatic number: at most " << result.coloring.count
+                  << " (graph too large for the exact search)" << std::endl;
+    else {
+        std::cout << "Chromatic number: between " << result.lowerBound << " and " << result.coloring.count
+                  << " (time limit reached)" << std::endl;
+        if (result.probableBound > result.lowerBound)
+            std::cout << "Inclusion-exclusion suggests " << result.probableBound << " (probabilistic, not proven)"
+                      << std::endl;
+    }
+    for (int v = 0; v < compact->countNodes(); v++) {
+        std::cout << "Node " << compact->name(v) << " ---> Color " << result.coloring.color[v] << std::endl;
+        resultToSent.emplace_back(compact->name(v), std::to_string(result.coloring.color[v]));
+    }
+    return resultToSent;
+}
+
+std::list<std::string> GraphUtils::getMaximumClique(const Graph *graph) {
+    auto compact = snapshot(graph);
+    return trailNames(*compact, CliqueEngine::maximumClique(*compact).nodes);
+}
+
+std::list<std::string> GraphUtils::getMaximumIndependentSet(const Graph *graph) {
+    auto compact = snapshot(graph);
+    return trailNames(*compact, CliqueEngine::maximumIndependentSet(*compact).nodes);
+}
+
+std::list<std::list<std::string>> printNodeSet(const CompactGraph &compact, const CliqueResult &found,
+                                               const std::string &title) {
+    std::list<std::list<std::string>> result;
+    if (found.nodes.empty() && compact.countNodes()) {
+        std::cout << title << ": not found!\n";
+        return result;
+    }
+    result.push_back(trailNames(compact, found.nodes));
+    std::cout << title << " (size = " << found.nodes.size() << (found.optimal ? "" : ", time limit reached")
+              << "): ";
+    for (auto &node: result.front())
+        std::cout << node << " ";
+    std::cout << "\n";
+    return result;
+}
+
+std::list<std::list<std::string>> GraphUtils::displayMaximumClique(const Graph *graph) {
+    auto compact = snapshot(graph);
+    return printNodeSet(*compact, CliqueEngine::maximumClique(*compact), "Maximum clique");
+}
+
+std::list<std::list<std::string>> GraphUtils::displayMaximumIndependentSet(const Graph *graph) {
+    auto compact = snapshot(graph);
+    if (compact->countNodes() > CliqueEngine::complementLimit) {
+        std::cout << "Maximum independent set: the graph has more than " << CliqueEngine::complementLimit
+                  << " nodes\n";
+        return std::list<std::list<std::string>>();
+    }
+    return printNodeSet(*compact, CliqueEngine::maximumIndependentSet(*compact), "Maximum independent set");
+}
+
+BitMatrix GraphUtils::getTransitiveClosure(const Graph *graph) {
+    if (graph->countNodes() > ClosureEngine::nodeLimit)
+        return BitMatrix();
+    return ClosureEngine::transitiveClosure(*snapshot(graph));
+}
+
+BitMatrix GraphUtils::displayTransitiveClosure(const Graph *graph) {
+    if (graph->countNodes() > ClosureEngine::nodeLimit) {
+        std::cout << "Transitive closure: the graph has more than " << ClosureEngine::nodeLimit << " nodes\n";
+        return BitMatrix();
+    }
+    auto closure = getTransitiveClosure(graph);
+    long long n = graph->countNodes();
+    std::cout << "Transitive closure: " << closure.count() << " of " << n * n << " ordered pairs are reachable\n";
+    return closure;
+}
+
+long long GraphUtils::getMaxFlow(const Graph *graph, const std::string &source, const std::string &sink,
+                                 FlowAlgorithm algorithm) {
+    if (!graph->hasNode(source) || !graph->hasNode(sink)) return 0;
+    auto compact = snapshot(graph);
+    return FlowEngine::maxFlow(*compact, compact->id(source), compact->id(sink), algorithm).value;
+}
+
+std::list<std::pair<std::string, std::string>> cutNames(const CompactGraph &compact, const FlowResult &flow) {
+    std::list<std::pair<std::string, std::string>> result;
+    for (int e: flow.cut)
+        result.emplace_back(compact.name(compact.edge(e).u), compact.name(compact.edge(e).v));
+    return result;
+}
+
+std::list<std::pair<std::string, std::string>>
+GraphUtils::getMinCut(const Graph *graph, const std::string &source, const std::string &sink) {
+    if (!graph->hasNode(source) || !graph->hasNode(sink) || source == sink)
+        return std::list<std::pair<std::string, std::string>>();
+    auto compact = snapshot(graph);
+    return cutNames(*compact, FlowEngine::maxFlow(*compact, compact->id(source), compact->id(sink)));
+}
+
+std::list<std::list<std::string>> cutSides(const CompactGraph &compact, const GlobalCut &cut) {
+    std::list<std::list<std::string>> result(2);
+    for (int v = 0; v < compact.countNodes(); v++)
+        (cut.side[v] ? result.front() : result.back()).push_back(compact.name(v));
+    return result;
+}
+
+std::list<std::list<std::string>> GraphUtils::getMinimumCut(const Graph *graph, int trials) {
+    if (graph->countNodes() < 2) return std::list<std::list<std::string>>();
+    auto compact = snapshot(graph);
+    return cutSides(*compact, MinCutEngine::minimumCut(*compact, trials));
+}
+
+std::list<std::list<std::string>> GraphUtils::displayMinimumCut(const Graph *graph, int trials) {
+    if (graph->countNodes() < 2) {
+        std::cout << "Minimum cut: the graph needs at least two nodes\n";
+        return std::list<std::list<std::string>>();
+    }
+    auto compact = snapshot(graph);
+    auto cut = MinCutEngine::minimumCut(*compact, trials);
+    auto result = cutSides(*compact, cut);
+    std::cout << "Minimum cut weight: " << cut.weight << (cut.exact ? "" : " (Karger-Stein, may not be minimum)")
+              << "\n";
+    for (auto &side: result) {
+        std::cout << "Side (" << side.size() << " nodes): ";
+        for (auto &node: side)
+            std::cout << node << " ";
+        std::cout << "\n";
+    }
+    std::cout << "Cut edges:\n";
+    for (auto &edge: compact->edges())
+        if (edge.u != edge.v && cut.side[edge.u] != cut.side[edge.v])
+            std::cout << compact->name(edge.u) << " " << compact->name(edge.v) << "\n";
+    return result;
+}
+
+bool GraphUtils::isBipartite(const Graph *graph) {
+    return MatchingEngine::bipartition(*snapshot(graph)).bipartite;
+}
+
+// Matched pairs by name, each oriented like an edge of the graph so the scene can find it
+std::list<std::pair<std::string, std::string>>
+matchingNames(const Graph *graph, const CompactGraph &compact, const Bipartition &parts, long long &weight) {
+    std::list<std::pair<std::string, std::string>> result;
+    if (graph->isWeighted() && compact.countNodes() <= MatchingEngine::hungarianLimit) {
+        auto matrix = graph->adjMatrix();
+        std::vector<char> side(matrix.nodes().size());
+        for (size_t i = 0; i < side.size(); i++)
+            side[i] = parts.side[compact.id(matrix.node(i)->name())];
+        auto matching = MatchingEngine::hungarian(matrix, side, graph->invalidValue());
+        for (auto &pair: matching.pairs) {
+            auto u = matrix.node(pair.first)->name(), v = matrix.node(pair.second)->name();
+            if (graph->isDirected() && (!graph->hasEdge(u, v) ||
+                                        (graph->hasEdge(v, u) && graph->weight(v, u) > graph->weight(u, v))))
+                std::swap(u, v);
+            result.emplace_back(u, v);
+        }
+        weight = matching.weight;
+    } else {
+        auto matching = MatchingEngine::hopcroftKarp(compact, parts);
+        for (int e: matching.edges)
+            result.emplace_back(compact.name(compact.edge(e).u), compact.name(compact.edge(e).v));
+        weight = matching.weight;
+    }
+    return result;
+}
+
+std::list<std::pair<std::string, std::string>> GraphUtils::getMaximumMatching(const Graph *graph) {
+    auto compact = snapshot(graph);
+    auto parts = MatchingEngine::bipartition(*compact);
+    long long weight = 0;
+    if (!parts.bipartite) return std::list<std::pair<std::string, std::string>>();
+    return matchingNames(graph, *compact, parts, weight);
+}
+
+std::list<std::pair<std::string, std::string>> GraphUtils::displayMaximumMatching(const Graph *graph) {
+    std::list<std::pair<std::string, std::string>> result;
+    auto compact = snapshot(graph);
+    auto parts = MatchingEngine::bipartition(*compact);
+    if (!parts.bipartite) {
+        std::cout << "The graph is not bipartite, odd cycle: ";
+        for (int v: parts.oddCycle)
+            std::cout << compact->name(v) << " ";
+        std::cout << "\n";
+        for (size_t i = 0; i < parts.oddCycle.size(); i++) {
+            auto u = compact->name(parts.oddCycle[i]);
+            auto v = compact->name(parts.oddCycle[(i + 1) % parts.oddCycle.size()]);
+            result.emplace_back(graph->isDirected() && !graph->hasEdge(u, v) ? std::make_pair(v, u)
+                                                                            : std::make_pair(u, v));
+        }
+        return result;
+    }
+    long long weight = 0;
+    result = matchingNames(graph, *compact, parts, weight);
+    std::cout << "Maximum matching size: " << result.size() << "\n";
+    if (graph->isWeighted())
+        std::cout << "Matching weight: " << weight << "\n";
+    for (auto &edge: result)
+        std::cout << edge.first << " " << edge.second << "\n";
+    return result;
+}
+
+struct PowerCentralities {
+    Centrality pageRank;
+    Centrality eigenvector;
+};
+
+RevisionCache<PowerCentralities> &centralityCache() {
+    static RevisionCache<PowerCentralities> cache;
+    return cache;
+}
+
+const PowerCentralities &cachedCentrality(const Graph *graph) {
+    return centralityCache().get(graph, [&]() {
+        auto compact = snapshot(graph);
+        return PowerCentralities{CentralityEngine::pageRank(*compact), CentralityEngine::eigenvector(*compact)};
+    });
+}
+
+bool GraphUtils::hasCentrality(const Graph *graph) {
+    return centralityCache().find(graph) != nullptr;
+}
+
+std::list<std::pair<std::string, double>> scoreNames(const CompactGraph &compact, const std::vector<double> &score) {
+    std::list<std::pair<std::string, double>> result;
+    for (int v = 0; v < compact.countNodes(); v++)
+        result.emplace_back(compact.name(v), score[v]);
+    return result;
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::getPageRank(const Graph *graph) {
+    return scoreNames(*snapshot(graph), cachedCentrality(graph).pageRank.score);
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::getEigenvectorCentrality(const Graph *graph) {
+    return scoreNames(*snapshot(graph), cachedCentrality(graph).eigenvector.score);
+}
+
+double GraphUtils::getPageRank(const Graph *graph, const std::string &node) {
+    if (!graph->hasNode(node)) return 0;
+    return cachedCentrality(graph).pageRank.score[snapshot(graph)->id(node)];
+}
+
+double GraphUtils::getEigenvectorCentrality(const Graph *graph, const std::string &node) {
+    if (!graph->hasNode(node)) return 0;
+    return cachedCentrality(graph).eigenvector.score[snapshot(graph)->id(node)];
+}
+
+// Prints both scores of the top nodes ranked by one of them and returns that one by node
+std::list<std::pair<std::string, double>> printCentralities(const Graph *graph, bool by_eigenvector, int top) {
+    auto compact = snapshot(graph);
+    auto &cache = cachedCentrality(graph);
+    auto &ranking = by_eigenvector ? cache.eigenvector.score : cache.pageRank.score;
+    std::cout << "PageRank: " << cache.pageRank.iterations << " iterations"
+              << (cache.pageRank.converged ? "" : " (not converged)") << "\n";
+    std::cout << "Eigenvector centrality: " << cache.eigenvector.iterations << " iterations"
+              << (cache.eigenvector.converged ? "" : " (not converged)") << "\n";
+    std::vector<int> order(compact->countNodes());
+    for (int v = 0; v < compact->countNodes(); v++)
+        order[v] = v;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return ranking[a] > ranking[b];
+    });
+    if (top < (int) order.size())
+        order.resize(std::max(top, 0));
+    std::cout << "Node PageRank Eigenvector\n";
+    for (int v: order)
+        std::cout << compact->name(v) << " " << cache.pageRank.score[v] << " " << cache.eigenvector.score[v] << "\n";
+    return scoreNames(*compact, ranking);
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::displayPageRank(const Graph *graph, int top) {
+    return printCentralities(graph, false, top);
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::displayEigenvectorCentrality(const Graph *graph, int top) {
+    return printCentralities(graph, true, top);
+}
+
+RevisionCache<Betweenness> &betweennessCache() {
+    static RevisionCache<Betweenness> cache;
+    return cache;
+}
+
+const Betweenness &cachedBetweenness(const Graph *graph) {
+    return betweennessCache().get(graph, [&]() {
+        bool sampled = graph->countNodes() > CentralityEngine::exactSourceLimit;
+        int samples = sampled ? CentralityEngine::defaultSamples : 0;
+        return CentralityEngine::betweenness(*snapshot(graph), samples);
+    });
+}
+
+bool GraphUtils::hasBetweenness(const Graph *graph) {
+    return betweennessCache().find(graph) != nullptr;
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::getBetweenness(const Graph *graph) {
+    return scoreNames(*snapshot(graph), cachedBetweenness(graph).node);
+}
+
+double GraphUtils::getBetweenness(const Graph *graph, const std::string &node) {
+    if (!graph->hasNode(node)) return 0;
+    return cachedBetweenness(graph).node[snapshot(graph)->id(node)];
+}
+
+double GraphUtils::getEdgeBetweenness(const Graph *graph, const std::string &uname, const std::string &vname) {
+    if (!graph->hasEdge(uname, vname)) return 0;
+    auto compact = snapshot(graph);
+    int u = compact->id(uname), v = compact->id(vname);
+    for (int a = compact->outBegin(u); a < compact->outEnd(u); a++)
+        if (compact->target(a) == v)
+            return cachedBetweenness(graph).edge[compact->arcEdge(a)];
+    return 0;
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::displayBetweenness(const Graph *graph, int top) {
+    auto compact = snapshot(graph);
+    auto &betweenness = cachedBetweenness(graph);
+    std::cout << "Betweenness centrality";
+    if (!betweenness.exact)
+        std::cout << " (estimated from " << betweenness.sources << " sampled sources)";
+    std::cout << "\n";
+    std::vector<int> order(compact->countNodes());
+    for (int v = 0; v < compact->countNodes(); v++)
+        order[v] = v;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return betweenness.node[a] > betweenness.node[b];
+    });
+    if (top < (int) order.size())
+        order.resize(std::max(top, 0));
+    for (int v: order)
+        std::cout << compact->name(v) << " " << betweenness.node[v] << "\n";
+    return scoreNames(*compact, betweenness.node);
+}
+
+RevisionCache<TriangleCount> &triangleCache() {
+    static RevisionCache<TriangleCount> cache;
+    return cache;
+}
+
+const TriangleCount &cachedTriangles(const Graph *graph) {
+    return triangleCache().get(graph, [&]() { return TriangleEngine::count(*snapshot(graph)); });
+}
+
+bool GraphUtils::hasClustering(const Graph *graph) {
+    return triangleCache().find(graph) != nullptr;
+}
+
+long long GraphUtils::getTriangleCount(const Graph *graph) {
+    return cachedTriangles(graph).triangles;
+}
+
+double GraphUtils::getClusteringCoefficient(const Graph *graph, const std::string &node) {
+    if (!graph->hasNode(node)) return 0;
+    return cachedTriangles(graph).clustering[snapshot(graph)->id(node)];
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::displayClustering(const Graph *graph, int top) {
+    auto compact = snapshot(graph);
+    auto &count = cachedTriangles(graph);
+    std::cout << "Triangles: " << count.triangles << "\n";
+    std::cout << "Global clustering coefficient: " << count.transitivity << "\n";
+    std::cout << "Average local clustering coefficient: " << count.averageClustering << "\n";
+    std::vector<int> order(compact->countNodes());
+    for (int v = 0; v < compact->countNodes(); v++)
+        order[v] = v;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return count.local[a] > count.local[b];
+    });
+    if (top < (int) order.size())
+        order.resize(std::max(top, 0));
+    std::cout << "Node Triangles Clustering\n";
+    for (int v: order)
+        std::cout << compact->name(v) << " " << count.local[v] << " " << count.clustering[v] << "\n";
+    return scoreNames(*compact, count.clustering);
+}
+
+RevisionCache<CoreDecomposition> &coreCache() {
+    static RevisionCache<CoreDecomposition> cache;
+    return cache;
+}
+
+const CoreDecomposition &cachedCores(const Graph *graph) {
+    return coreCache().get(graph, [&]() { return CoreEngine::decompose(*snapshot(graph)); });
+}
+
+bool GraphUtils::hasCoreNumbers(const Graph *graph) {
+    return coreCache().find(graph) != nullptr;
+}
+
+std::list<std::pair<std::string, int>> GraphUtils::getCoreNumbers(const Graph *graph) {
+    std::list<std::pair<std::string, int>> result;
+    auto compact = snapshot(graph);
+    auto &cores = cachedCores(graph);
+    for (int v = 0; v < compact->countNodes(); v++)
+        result.emplace_back(compact->name(v), cores.core[v]);
+    return result;
+}
+
+int GraphUtils::getCoreNumber(const Graph *graph, const std::string &node) {
+    if (!graph->hasNode(node)) return 0;
+    return cachedCores(graph).core[snapshot(graph)->id(node)];
+}
+
+int GraphUtils::getDegeneracy(const Graph *graph) {
+    return cachedCores(graph).degeneracy;
+}
+
+std::list<std::string> GraphUtils::getKCore(const Graph *graph, int k) {
+    std::list<std::string> result;
+    auto compact = snapshot(graph);
+    auto &cores = cachedCores(graph);
+    for (int v = 0; v < compact->countNodes(); v++)
+        if (cores.core[v] >= k)
+            result.push_back(compact->name(v));
+    return result;
+}
+
+std::list<std::string> GraphUtils::displayKCore(const Graph *graph, int k) {
+    auto &cores = cachedCores(graph);
+    auto result = getKCore(graph, k);
+    std::cout << "Degeneracy: " << cores.degeneracy << "\n";
+    std::vector<int> sizes(cores.degeneracy + 1, 0);
+    for (int core: cores.core)
+        sizes[core]++;
+    std::cout << "Core number: nodes\n";
+    for (int c = 0; c <= cores.degeneracy; c++)
+        if (sizes[c] > 0)
+            std::cout << c << ": " << sizes[c] << "\n";
+    std::cout << k << "-core: " << result.size() << " nodes\n";
+    return result;
+}
+
+std::list<std::list<std::string>> communityNames(const CompactGraph &compact, const Communities &communities) {
+    std::vector<std::list<std::string>> groups(communities.count);
+    for (int v = 0; v < compact.countNodes(); v++)
+        groups[communities.community[v]].push_back(compact.name(v));
+    std::stable_sort(groups.begin(), groups.end(),
+                     [](const std::list<std::string> &a, const std::list<std::string> &b) {
+                         return a.size() > b.size();
+                     });
+    return std::list<std::list<std::string>>(groups.begin(), groups.end());
+}
+
+Communities detectCommunities(const CompactGraph &compact, bool label_propagation) {
+    return label_propagation ? CommunityEngine::labelPropagation(compact) : CommunityEngine::louvain(compact);
+}
+
+std::list<std::list<std::string>> GraphUtils::getCommunities(const Graph *graph, bool label_propagation) {
+    auto compact = snapshot(graph);
+    return communityNames(*compact, detectCommunities(*compact, label_propagation));
+}
+
+std::list<std::list<std::string>> GraphUtils::displayCommunities(const Graph *graph, bool label_propagation) {
+    auto compact = snapshot(graph);
+    auto communities = detectCommunities(*compact, label_propagation);
+    auto result = communityNames(*compact, communities);
+    std::cout << "Number of communities (" << (label_propagation ? "label propagation" : "Louvain") << "): "
+              << communities.count << "\n";
+    std::cout << "Modularity: " << communities.modularity << "\n";
+    for (const auto &group: result) {
+        for (const auto &node: group)
+            std::cout << node << " ";
+        std::cout << "\n";
+    }
+    return result;
+}
+
+// Every node's eccentricity up to DistanceEngine::exactNodeLimit nodes, a sample of them beyond
+RevisionCache<Eccentricities> &eccentricityCache() {
+    static RevisionCache<Eccentricities> cache;
+    return cache;
+}
+
+const Eccentricities &cachedEccentricities(const Graph *graph) {
+    return eccentricityCache().get(graph, [&]() {
+        bool sampled = graph->countNodes() > DistanceEngine::exactNodeLimit;
+        int samples = sampled ? DistanceEngine::defaultSamples : 0;
+        return DistanceEngine::eccentricities(*snapshot(graph), samples);
+    });
+}
+
+bool eccentricitiesAffordable(const Graph *graph) {
+    return graph->countNodes() <= DistanceEngine::exactNodeLimit;
+}
+
+// Hop distances from one node, for graphs too large to cache every node's; the last node asked
+// about is kept, keyed on its id
+RevisionCache<Reach> &reachCache() {
+    static RevisionCache<Reach> cache;
+    return cache;
+}
+
+Reach reachFrom(const Graph *graph, const std::string &node) {
+    auto compact = snapshot(graph);
+    int id = compact->id(node);
+    return reachCache().get(graph, [&]() { return DistanceEngine::traverse(*compact, {id})[0]; }, id);
+}
+
+bool GraphUtils::hasDistances(const Graph *graph, const std::string &node) {
+    if (eccentricitiesAffordable(graph))
+        return eccentricityCache().find(graph) != nullptr;
+    return graph->hasNode(node) && reachCache().find(graph, snapshot(graph)->id(node)) != nullptr;
+}
+
+// Nodes of the cached closeness, by id: all of them or the sampled ones
+std::vector<int> closenessNodes(const Eccentricities &distances) {
+    std::vector<int> nodes(distances.sources);
+    std::sort(nodes.begin(), nodes.end());
+    return nodes;
+}
+
+std::pair<int, int> GraphUtils::getDiameterBounds(const Graph *graph, int max_traversals) {
+    static RevisionCache<Diameter> cache;
+    auto &diameter = cache.get(graph, [&]() {
+        return DistanceEngine::diameter(*snapshot(graph), max_traversals);
+    }, max_traversals);
+    return {diameter.lower, diameter.upper};
+}
+
+int GraphUtils::getDiameter(const Graph *graph) {
+    if (!graph->isDirected())
+        return getDiameterBounds(graph).first;
+    return eccentricitiesAffordable(graph) ? cachedEccentricities(graph).diameter : -1;
+}
+
+int GraphUtils::getRadius(const Graph *graph) {
+    return eccentricitiesAffordable(graph) ? cachedEccentricities(graph).radius : -1;
+}
+
+int GraphUtils::getEccentricity(const Graph *graph, const std::string &node) {
+    if (!graph->hasNode(node)) return 0;
+    if (eccentricitiesAffordable(graph))
+        return cachedEccentricities(graph).eccentricity[snapshot(graph)->id(node)];
+    return reachFrom(graph, node).eccentricity;
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::getClosenessCentrality(const Graph *graph) {
+    auto compact = snapshot(graph);
+    auto &distances = cachedEccentricities(graph);
+    std::list<std::pair<std::string, double>> result;
+    for (int v: closenessNodes(distances))
+        result.emplace_back(compact->name(v), distances.closeness[v]);
+    return result;
+}
+
+double GraphUtils::getClosenessCentrality(const Graph *graph, const std::string &node) {
+    if (!graph->hasNode(node)) return 0;
+    if (eccentricitiesAffordable(graph))
+        return cachedEccentricities(graph).closeness[snapshot(graph)->id(node)];
+    auto reach = reachFrom(graph, node);
+    if (reach.distances == 0) return 0;
+    double r = reach.reached - 1;
+    return r * r / ((graph->countNodes() - 1) * (double) reach.distances);
+}
+
+std::list<std::pair<std::string, double>> GraphUtils::displayCloseness(const Graph *graph, int top) {
+    auto compact = snapshot(graph);
+    auto &distances = cachedEccentricities(graph);
+    if (distances.exact) {
+        std::cout << "Diameter: " << distances.diameter << "\n";
+        std::cout << "Radius: " << distances.radius << "\n";
+    } else {
+        std::cout << "Closeness of " << distances.sources.size() << " sampled nodes out of " << compact->countNodes()
+                  << "\n";
+        std::cout << "Diameter: at least " << distances.diameter << "\n";
+        std::cout << "Radius: at most " << distances.radius << "\n";
+    }
+    if (!distances.connected)
+        std::cout << "Not every node reaches every other one; eccentricities only count reachable nodes\n";
+    auto order = closenessNodes(distances);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return distances.closeness[a] > distances.closeness[b];
+    });
+    if (top < (int) order.size())
+        order.resize(std::max(top, 0));
+    std::cout << "Node Closeness Eccentricity\n";
+    for (int v: order)
+        std::cout << compact->name(v) << " " << distances.closeness[v] << " " << distances.eccentricity[v] << "\n";
+    return getClosenessCentrality(graph);
+}
+
+std::list<std::pair<std::string, std::string>>
+GraphUtils::displayMaxFlow(const Graph *graph, const std::string &source, const std::string &sink,
+                           FlowAlgorithm algorithm) {
+    if (!graph->hasNode(source) || !graph->hasNode(sink) || source == sink)
+        return std::list<std::pair<std::string, std::string>>();
+    auto compact = snapshot(graph);
+    auto flow = FlowEngine::maxFlow(*compact, compact->id(source), compact->id(sink), algorithm);
+    auto result = cutNames(*compact, flow);
+    std::cout << "Maximum flow from " << source << " to " << sink << ": " << flow.value << "\n";
+    std::cout << "Minimum cut edges: " << result.size() << "\n";
+    for (auto &edge: result)
+        std::cout << edge.first << " " << edge.second << "\n";
+    return result;
+}
+
 std::list<std::pair<std::string, std::string>> GraphUtils::usualST(const Graph *graph, const std::string &source) {
     std::list<std::pair<std::string, std::string>> result;
     std::unordered_map<std::string, bool> visited;
@@ -0,0 +1,261 @@
+#include "basis/headers/HamiltonianEngine.h"
+#include "basis/headers/ComponentEngine.h"
+#include "basis/headers/SmallGraph.h"
+#include "utils/bits.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+using namespace GraphType;
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    bool hasArc(const CompactGraph &graph, int u, int v) {
+        for (int a = graph.outBegin(u); a < graph.outEnd(u); a++)
+            if (graph.target(a) == v)
+                return true;
+        return false;
+    }
+
+    // remIn[x] counts in-neighbours of x that are unvisited or the current path end,
+    // remOut[x] counts out-neighbours of x that are unvisited or node 0; an unvisited node
+    // whose count drops to zero can no longer be entered or left, so the branch is dead.
+    class HamiltonianSearch {
+    public:
+        HamiltonianSearch(const CompactGraph &graph, std::atomic<bool> &stop, Clock::time_point deadline) :
+                _graph(graph), _stop(stop), _deadline(deadline),
+                _visited(graph.countNodes(), false), _remIn(graph.countNodes()), _remOut(graph.countNodes()) {
+            for (int v = 0; v < graph.countNodes(); v++) {
+                _remIn[v] = graph.inDegree(v);
+                _remOut[v] = graph.outDegree(v);
+            }
+            _visited[0] = true;
+            path.push_back(0);
+        }
+
+        bool run(const std::vector<int> &prefix) {
+            int applied = 0;
+            bool alive = true;
+            for (int w: prefix) {
+                if (_visited[w]) {
+                    alive = false;
+                    break;
+                }
+                applied++;
+                if (!move(w)) {
+                    alive = false;
+                    break;
+                }
+            }
+            bool found = alive && search();
+            if (found) return true;
+            while (applied--)
+                retract();
+            return false;
+        }
+
+        std::vector<int> path;
+        bool timedOut = false;
+
+    private:
+        const CompactGraph &_graph;
+        std::atomic<bool> &_stop;
+        Clock::time_point _deadline;
+        std::vector<bool> _visited;
+        std::vector<int> _remIn;
+        std::vector<int> _remOut;
+        std::vector<int> _queue;
+        std::vector<int> _seen;
+        long long _expanded = 0;
+
+        bool move(int w) {
+            int v = path.back();
+            bool alive = true;
+            for (int a = _graph.outBegin(v); a < _graph.outEnd(v); a++) {
+                int x = _graph.target(a);
+                if (--_remIn[x] == 0 && x != w && (x == 0 || !_visited[x]))
+                    alive = false;
+            }
+            _visited[w] = true;
+            path.push_back(w);
+            for (int a = _graph.inBegin(w); a < _graph.inEnd(w); a++) {
+                int x = _graph.source(a);
+                if (--_remOut[x] == 0 && !_visited[x])
+                    alive = false;
+            }
+            return alive;
+        }
+
+        void retract() {
+            int w = path.back();
+            path.pop_back();
+            for (int a = _graph.inBegin(w); a < _graph.inEnd(w); a++)
+                _remOut[_graph.source(a)]++;
+            _visited[w] = false;
+            int v = path.back();
+            for (int a = _graph.outBegin(v); a < _graph.outEnd(v); a++)
+                _remIn[_graph.target(a)]++;
+        }
+
+        bool restReachable() {
+            int n = _graph.countNodes(), need = n - (int) path.size();
+            _seen.assign(n, 0);
+            _queue.assign(1, path.back());
+            _seen[path.back()] = 1;
+            int reached = 0;
+            for (int i = 0; i < (int) _queue.size() && reached < need; i++) {
+                int u = _queue[i];
+                for (int a = _graph.outBegin(u); a < _graph.outEnd(u); a++) {
+                    int x = _graph.target(a);
+                    if (!_visited[x] && !_seen[x]) {
+                        _seen[x] = 1;
+                        reached++;
+                        _queue.push_back(x);
+                    }
+                }
+            }
+            return reached == need;
+        }
+
+        bool search() {
+            if (_stop.load(std::memory_order_relaxed)) return false;
+            if ((++_expanded & 1023) == 0 && Clock::now() > _deadline) {
+                timedOut = true;
+                _stop = true;
+                return false;
+            }
+            int v = path.back();
+            if ((int) path.size() == _graph.countNodes())
+                return hasArc(_graph, v, 0);
+            if (path.size() % 8 == 0 && !restReachable())
+                return false;
+
+            // a neighbour whose only possible predecessor left is v has to come next
+            std::vector<int> candidates;
+            int forced = -1;
+            for (int a = _graph.outBegin(v); a < _graph.outEnd(v); a++) {
+                int w = _graph.target(a);
+                if (_visited[w]) continue;
+                if (_remIn[w] == 1) {
+                    if (forced != -1) return false;
+                    forced = w;
+                }
+                candidates.push_back(w);
+            }
+            if (forced != -1)
+                candidates.assign(1, forced);
+            std::sort(candidates.begin(), candidates.end(), [this](int x, int y) {
+                return _remOut[x] < _remOut[y];
+            });
+            for (int w: candidates) {
+                if (move(w) && search())
+                    return true;
+                retract();
+            }
+            return false;
+        }
+    };
+}
+
+HamiltonianResult HamiltonianEngine::heldKarp(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    HamiltonianResult result;
+    if (n > heldKarpLimit || n < (graph.isDirected() ? 2 : 3)) return result;
+
+    // the 2^n table is only worth filling when node 0 reaches every node and every node reaches it
+    SmallGraph<64> small(graph);
+    if ((int) small.reachable(0).count() < n || (int) small.reachable(0, true).count() < n)
+        return result;
+
+    // node i >= 1 is bit i - 1, so shifting a row right by one drops node 0
+    int m = n - 1;
+    auto from_start = (std::uint32_t) (small.out(0) >> 1).to_ullong();
+    auto to_start = (std::uint32_t) (small.in(0) >> 1).to_ullong();
+    std::vector<std::uint32_t> in_mask(m);
+    for (int v = 1; v < n; v++)
+        in_mask[v - 1] = (std::uint32_t) (small.in(v) >> 1).to_ullong();
+
+    std::vector<std::uint32_t> reach((size_t) 1 << m, 0);
+    for (std::uint32_t mask = 1; mask < (1u << m); mask++) {
+        std::uint32_t ends = 0;
+        for (std::uint32_t rest = mask; rest; rest &= rest - 1) {
+            int b = Bits::lowest(rest);
+            std::uint32_t prev = mask ^ (1u << b);
+            if (prev == 0 ? (from_start >> b & 1) : (reach[prev] & in_mask[b]) != 0)
+                ends |= 1u << b;
+        }
+        reach[mask] = ends;
+    }
+
+    std::uint32_t mask = (1u << m) - 1;
+    std::uint32_t closing = reach[mask] & to_start;
+    if (!closing) return result;
+    int b = Bits::lowest(closing);
+    std::vector<int> reversed;
+    while (true) {
+        reversed.push_back(b + 1);
+        mask ^= 1u << b;
+        if (!mask) break;
+        b = Bits::lowest(reach[mask] & in_mask[b]);
+    }
+    result.status = HamiltonianStatus::CycleFound;
+    result.cycle.push_back(0);
+    result.cycle.insert(result.cycle.end(), reversed.rbegin(), reversed.rend());
+    return result;
+}
+
+HamiltonianResult HamiltonianEngine::branchAndBound(const CompactGraph &graph, int time_limit_ms) {
+    int n = graph.countNodes();
+    HamiltonianResult result;
+    if (n < (graph.isDirected() ? 2 : 3)) return result;
+    for (int v = 0; v < n; v++)
+        if (graph.outDegree(v) == 0 || graph.inDegree(v) == 0 || (!graph.isDirected() && graph.outDegree(v) < 2))
+            return result;
+    if (ComponentEngine::stronglyConnected(graph).count > 1)
+        return result;
+
+    // the first two steps from node 0 form the independent tasks shared out between threads
+    std::vector<std::vector<int>> prefixes;
+    for (int a = graph.outBegin(0); a < graph.outEnd(0); a++) {
+        int first = graph.target(a);
+        for (int b = graph.outBegin(first); b < graph.outEnd(first); b++)
+            if (graph.target(b) != 0)
+                prefixes.push_back({first, graph.target(b)});
+    }
+    if (n == 2)
+        prefixes.assign(1, {1});
+
+    auto deadline = Clock::now() + std::chrono::milliseconds(time_limit_ms);
+    std::atomic<bool> stop(false);
+    std::vector<std::unique_ptr<HamiltonianSearch>> searches(Parallel::threadCount());
+    std::mutex found_mutex;
+    Parallel::forDynamic((int) prefixes.size(), [&](int tid, int i) {
+        if (stop) return;
+        if (!searches[tid])
+            searches[tid].reset(new HamiltonianSearch(graph, stop, deadline));
+        if (searches[tid]->run(prefixes[i])) {
+            std::lock_guard<std::mutex> lock(found_mutex);
+            if (result.status != HamiltonianStatus::CycleFound) {
+                result.status = HamiltonianStatus::CycleFound;
+                result.cycle = searches[tid]->path;
+            }
+            stop = true;
+        }
+    });
+    if (result.status != HamiltonianStatus::CycleFound) {
+        for (auto &search: searches)
+            if (search && search->timedOut)
+                result.status = HamiltonianStatus::SearchTimedOut;
+    }
+    return result;
+}
+
+HamiltonianResult HamiltonianEngine::findCycle(const CompactGraph &graph, int time_limit_ms) {
+    if (graph.countNodes() <= heldKarpLimit)
+        return heldKarp(graph);
+    return branchAndBound(graph, time_limit_ms);
+}
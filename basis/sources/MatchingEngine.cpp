@@ -0,0 +1,243 @@
+#include "basis/headers/MatchingEngine.h"
+#include <algorithm>
+#include <climits>
+
+using namespace GraphType;
+
+Bipartition MatchingEngine::bipartition(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    Bipartition result;
+    result.side.assign(n, 0);
+    std::vector<int> parent(n, -1), depth(n, -1), queue;
+    queue.reserve(n);
+    // a self-loop is an odd cycle on its own; the traversal below only sees other neighbours
+    for (auto &edge: graph.edges())
+        if (edge.u == edge.v) {
+            result.bipartite = false;
+            result.oddCycle.assign(1, edge.u);
+            return result;
+        }
+    for (int root = 0; root < n && result.bipartite; root++) {
+        if (depth[root] != -1) continue;
+        depth[root] = 0;
+        queue.assign(1, root);
+        for (size_t i = 0; i < queue.size() && result.bipartite; i++) {
+            int v = queue[i];
+            graph.forSimpleNeighbours(v, [&](int w, int) {
+                if (!result.bipartite) return;
+                if (depth[w] == -1) {
+                    depth[w] = depth[v] + 1;
+                    parent[w] = v;
+                    result.side[w] = !result.side[v];
+                    queue.push_back(w);
+                } else if (result.side[w] == result.side[v]) {
+                    // both tree paths climb to their lowest common ancestor and close the odd cycle
+                    result.bipartite = false;
+                    std::vector<int> up, down;
+                    int x = v, y = w;
+                    while (depth[x] > depth[y])
+                        up.push_back(x), x = parent[x];
+                    while (depth[y] > depth[x])
+                        down.push_back(y), y = parent[y];
+                    while (x != y) {
+                        up.push_back(x), x = parent[x];
+                        down.push_back(y), y = parent[y];
+                    }
+                    up.push_back(x);
+                    up.insert(up.end(), down.rbegin(), down.rend());
+                    result.oddCycle.swap(up);
+                }
+            });
+        }
+    }
+    return result;
+}
+
+Matching MatchingEngine::hopcroftKarp(const CompactGraph &graph, const Bipartition &parts) {
+    int n = graph.countNodes();
+    Matching result;
+    result.mate.assign(n, -1);
+
+    // left nodes keep their arcs to the right side only
+    std::vector<int> offsets(n + 1, 0), head, edge_of;
+    for (int v = 0; v < n; v++) {
+        offsets[v + 1] = offsets[v];
+        if (parts.side[v]) continue;
+        graph.forSimpleNeighbours(v, [&](int w, int e) {
+            if (parts.side[w]) {
+                head.push_back(w);
+                edge_of.push_back(e);
+                offsets[v + 1]++;
+            }
+        });
+    }
+    std::vector<int> mate_edge(n, -1);
+
+    // greedy start: most nodes are matched here and the phases only fix up the rest
+    for (int v = 0; v < n; v++)
+        for (int a = offsets[v]; a < offsets[v + 1] && result.mate[v] == -1; a++)
+            if (result.mate[head[a]] == -1) {
+                result.mate[v] = head[a];
+                result.mate[head[a]] = v;
+                mate_edge[v] = edge_of[a];
+            }
+
+    std::vector<int> dist(n), cur(n), queue, path;
+    queue.reserve(n);
+    while (true) {
+        // layers alternate left nodes and their mates; free right nodes end the search
+        queue.clear();
+        for (int v = 0; v < n; v++)
+            if (!parts.side[v] && result.mate[v] == -1) {
+                dist[v] = 0;
+                queue.push_back(v);
+            } else
+                dist[v] = INT_MAX;
+        int found = INT_MAX;
+        for (size_t i = 0; i < queue.size(); i++) {
+            int v = queue[i];
+            if (dist[v] >= found) break;
+            for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+                int m = result.mate[head[a]];
+                if (m == -1)
+                    found = std::min(found, dist[v] + 1);
+                else if (dist[m] == INT_MAX) {
+                    dist[m] = dist[v] + 1;
+                    queue.push_back(m);
+                }
+            }
+        }
+        if (found == INT_MAX) break;
+
+        std::copy(offsets.begin(), offsets.end() - 1, cur.begin());
+        for (int root = 0; root < n; root++) {
+            if (parts.side[root] || result.mate[root] != -1) continue;
+            // path holds the arcs taken from successive left nodes
+            path.clear();
+            int v = root;
+            while (true) {
+                int &a = cur[v];
+                bool augmented = false;
+                for (; a < offsets[v + 1]; a++) {
+                    int w = head[a], m = result.mate[w];
+                    if (m == -1 ? dist[v] + 1 == found : dist[m] == dist[v] + 1)
+                        break;
+                }
+                if (a < offsets[v + 1]) {
+                    path.push_back(a);
+                    int m = result.mate[head[a]];
+                    if (m == -1)
+                        augmented = true;
+                    else {
+                        v = m;
+                        continue;
+                    }
+                }
+                if (augmented) {
+                    int left = root;
+                    for (int arc: path) {
+                        int w = head[arc], next = result.mate[w];
+                        result.mate[left] = w;
+                        result.mate[w] = left;
+                        mate_edge[left] = edge_of[arc];
+                        left = next;
+                    }
+                    // the left nodes of the path are used up, which keeps this phase's paths disjoint
+                    for (int arc: path)
+                        dist[result.mate[head[arc]]] = INT_MAX;
+                    break;
+                }
+                // dead end: v cannot reach a free right node along the layers
+                dist[v] = INT_MAX;
+                if (path.empty()) break;
+                path.pop_back();
+                v = path.empty() ? root : result.mate[head[path.back()]];
+                cur[v]++;
+            }
+        }
+    }
+
+    for (int v = 0; v < n; v++)
+        if (!parts.side[v] && result.mate[v] != -1) {
+            result.edges.push_back(mate_edge[v]);
+            result.weight += graph.edge(mate_edge[v]).weight;
+        }
+    std::sort(result.edges.begin(), result.edges.end());
+    return result;
+}
+
+Matching MatchingEngine::hungarian(const AdjacencyMatrix &matrix, const std::vector<char> &side, int invalid_value) {
+    int n = (int) matrix.nodes().size();
+    Matching result;
+    result.mate.assign(n, -1);
+    std::vector<int> rows, cols;
+    for (int v = 0; v < n; v++)
+        (side[v] ? cols : rows).push_back(v);
+    if (rows.size() > cols.size())
+        rows.swap(cols);
+    int r = (int) rows.size(), c = (int) cols.size();
+    if (r == 0) return result;
+
+    auto gain = [&](int u, int v) -> long long {
+        long long best = 0;
+        if (matrix.value(u, v) != invalid_value)
+            best = std::max(best, (long long) matrix.value(u, v));
+        if (matrix.value(v, u) != invalid_value)
+            best = std::max(best, (long long) matrix.value(v, u));
+        return best;
+    };
+    std::vector<std::vector<long long>> cost(r, std::vector<long long>(c));
+    for (int i = 0; i < r; i++)
+        for (int j = 0; j < c; j++)
+            cost[i][j] = -gain(rows[i], cols[j]);
+
+    // rows and columns are 1-based below; column 0 is the virtual start of each augmenting search
+    std::vector<long long> row_pot(r + 1, 0), col_pot(c + 1, 0), slack(c + 1);
+    std::vector<int> owner(c + 1, 0), way(c + 1, 0);
+    std::vector<char> used(c + 1);
+    for (int i = 1; i <= r; i++) {
+        owner[0] = i;
+        int j0 = 0;
+        std::fill(slack.begin(), slack.end(), LLONG_MAX);
+        std::fill(used.begin(), used.end(), 0);
+        do {
+            used[j0] = 1;
+            int i0 = owner[j0], j1 = 0;
+            long long delta = LLONG_MAX;
+            for (int j = 1; j <= c; j++) {
+                if (used[j]) continue;
+                long long reduced = cost[i0 - 1][j - 1] - row_pot[i0] - col_pot[j];
+                if (reduced < slack[j]) {
+                    slack[j] = reduced;
+                    way[j] = j0;
+                }
+                if (slack[j] < delta) {
+                    delta = slack[j];
+                    j1 = j;
+                }
+            }
+            for (int j = 0; j <= c; j++)
+                if (used[j]) {
+                    row_pot[owner[j]] += delta;
+                    col_pot[j] -= delta;
+                } else
+                    slack[j] -= delta;
+            j0 = j1;
+        } while (owner[j0] != 0);
+        do {
+            int j1 = way[j0];
+            owner[j0] = owner[j1];
+            j0 = j1;
+        } while (j0 != 0);
+    }
+
+    for (int j = 1; j <= c; j++) {
+        if (owner[j] == 0 || cost[owner[j] - 1][j - 1] == 0) continue;
+        int u = rows[owner[j] - 1], v = cols[j - 1];
+        result.mate[u] = v;
+        result.mate[v] = u;
+        result.pairs.emplace_back(u, v);
+        result.weight -= cost[owner[j] - 1][j - 1];
+    }
+    return result;
+}
@@ -0,0 +1,405 @@
+#include "basis/headers/MinCutEngine.h"
+#include "utils/parallel.h"
+#include "utils/unionfind.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <queue>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+using namespace GraphType;
+
+namespace {
+
+    struct WeightedPair {
+        int a, b;
+        long long weight;
+    };
+
+    // sorts by endpoints and sums parallel pairs; a < b must already hold
+    void mergeParallel(std::vector<WeightedPair> &pairs) {
+        std::sort(pairs.begin(), pairs.end(), [](const WeightedPair &p1, const WeightedPair &p2) {
+            return p1.a != p2.a ? p1.a < p2.a : p1.b < p2.b;
+        });
+        size_t kept = 0;
+        for (size_t i = 0; i < pairs.size(); i++) {
+            if (kept > 0 && pairs[kept - 1].a == pairs[i].a && pairs[kept - 1].b == pairs[i].b)
+                pairs[kept - 1].weight += pairs[i].weight;
+            else
+                pairs[kept++] = pairs[i];
+        }
+        pairs.resize(kept);
+    }
+
+    // Supernodes left after the safe contractions of reduce(); group maps every node to one.
+    struct Reduction {
+        int nodes = 0;
+        std::vector<int> group;
+        std::vector<WeightedPair> pairs;
+    };
+
+    // Fills cut with the lightest single-supernode cut seen so far (Padberg-Rinaldi's upper bound)
+    // and contracts every edge at least that heavy, since no lighter cut can cross it; repeats while
+    // merged weights keep growing. Returns true when cut is already the answer: fewer than two
+    // nodes, a zero cut around one component, or everything contracted.
+    bool reduce(const CompactGraph &graph, Reduction &reduction, GlobalCut &cut) {
+        int n = graph.countNodes();
+        auto &pairs = reduction.pairs;
+        for (auto &edge: graph.edges())
+            if (edge.u != edge.v && edge.weight > 0)
+                pairs.push_back({std::min(edge.u, edge.v), std::max(edge.u, edge.v), edge.weight});
+        mergeParallel(pairs);
+        cut.weight = 0;
+        cut.side.assign(n, 0);
+        if (n < 2) return true;
+        UnionFind components(n);
+        for (auto &pair: pairs)
+            components.unite(pair.a, pair.b);
+        if (components.countSets() > 1) {
+            for (int v = 0; v < n; v++)
+                cut.side[v] = components.connected(v, 0);
+            return true;
+        }
+
+        reduction.nodes = n;
+        reduction.group.resize(n);
+        for (int v = 0; v < n; v++)
+            reduction.group[v] = v;
+        cut.weight = LLONG_MAX;
+        while (reduction.nodes > 1) {
+            std::vector<long long> degree(reduction.nodes, 0);
+            for (auto &pair: pairs) {
+                degree[pair.a] += pair.weight;
+                degree[pair.b] += pair.weight;
+            }
+            int lightest = (int) (std::min_element(degree.begin(), degree.end()) - degree.begin());
+            if (degree[lightest] < cut.weight) {
+                cut.weight = degree[lightest];
+                for (int v = 0; v < n; v++)
+                    cut.side[v] = reduction.group[v] == lightest;
+            }
+            UnionFind sets(reduction.nodes);
+            for (auto &pair: pairs)
+                if (pair.weight >= cut.weight)
+                    sets.unite(pair.a, pair.b);
+            if (sets.countSets() == reduction.nodes) return false;
+
+            std::vector<int> label(reduction.nodes, -1);
+            int count = 0;
+            for (int v = 0; v < reduction.nodes; v++)
+                if (sets.find(v) == v)
+                    label[v] = count++;
+            for (auto &group: reduction.group)
+                group = label[sets.find(group)];
+            std::vector<WeightedPair> contracted;
+            for (auto &pair: pairs) {
+                int a = label[sets.find(pair.a)], b = label[sets.find(pair.b)];
+                if (a != b)
+                    contracted.push_back({std::min(a, b), std::max(a, b), pair.weight});
+            }
+            mergeParallel(contracted);
+            pairs.swap(contracted);
+            reduction.nodes = count;
+        }
+        return true;
+    }
+
+    // Runs solver(pairs, node_num, side) on the reduced graph and keeps it when it beats the bound
+    template<class Solver>
+    GlobalCut solve(const CompactGraph &graph, bool exact, Solver solver) {
+        GlobalCut cut;
+        Reduction reduction;
+        if (reduce(graph, reduction, cut)) return cut;
+        std::vector<char> side;
+        long long weight = solver(reduction.pairs, reduction.nodes, side);
+        if (weight < cut.weight) {
+            cut.weight = weight;
+            for (int v = 0; v < graph.countNodes(); v++)
+                cut.side[v] = side[reduction.group[v]];
+        }
+        cut.exact = exact;
+        return cut;
+    }
+
+    long long bruteForce(const std::vector<WeightedPair> &pairs, int node_num, std::vector<char> &side) {
+        long long best = LLONG_MAX;
+        int best_mask = 0;
+        // the last node stays on side 0, so every cut is tried once
+        for (int mask = 1; mask < (1 << (node_num - 1)); mask++) {
+            long long weight = 0;
+            for (auto &pair: pairs)
+                if (((mask >> pair.a) & 1) != ((mask >> pair.b) & 1))
+                    weight += pair.weight;
+            if (weight < best) {
+                best = weight;
+                best_mask = mask;
+            }
+        }
+        side.resize(node_num);
+        for (int v = 0; v < node_num; v++)
+            side[v] = (best_mask >> v) & 1;
+        return best;
+    }
+
+    // Kruskal over exponential keys: the same distribution as contracting random edges picked
+    // with probability proportional to weight. label maps old nodes to the target new ones.
+    std::vector<WeightedPair> contract(const std::vector<WeightedPair> &pairs, int node_num, int target,
+                                       std::mt19937_64 &rng, std::vector<int> &label) {
+        std::exponential_distribution<double> exponential(1.0);
+        std::vector<std::pair<double, int>> order(pairs.size());
+        for (size_t i = 0; i < pairs.size(); i++)
+            order[i] = {exponential(rng) / (double) pairs[i].weight, (int) i};
+        std::sort(order.begin(), order.end());
+        UnionFind sets(node_num);
+        for (size_t i = 0; i < order.size() && sets.countSets() > target; i++)
+            sets.unite(pairs[order[i].second].a, pairs[order[i].second].b);
+
+        label.assign(node_num, -1);
+        int count = 0;
+        for (int v = 0; v < node_num; v++)
+            if (sets.find(v) == v)
+                label[v] = count++;
+        for (int v = 0; v < node_num; v++)
+            label[v] = label[sets.find(v)];
+        std::vector<WeightedPair> contracted;
+        for (auto &pair: pairs) {
+            int a = label[pair.a], b = label[pair.b];
+            if (a != b)
+                contracted.push_back({std::min(a, b), std::max(a, b), pair.weight});
+        }
+        mergeParallel(contracted);
+        return contracted;
+    }
+
+    // Below this many nodes contractions run on a weight matrix, O(n^2) each with no sorting
+    const int denseLimit = 1024;
+
+    long long denseContraction(std::vector<long long> matrix, int node_num, std::mt19937_64 &rng,
+                               std::vector<char> &side);
+
+    // Contracts the matrix (row-major, zero diagonal) to target nodes by picking an end of a random
+    // edge by weighted degree and the other end by row weight. The result is compacted in place.
+    void contractDense(std::vector<long long> &matrix, int node_num, int target, std::mt19937_64 &rng,
+                       std::vector<int> &label) {
+        std::vector<long long> degree(node_num, 0);
+        std::vector<int> alive(node_num), position(node_num);
+        for (int v = 0; v < node_num; v++) {
+            for (int x = 0; x < node_num; x++)
+                degree[v] += matrix[(size_t) v * node_num + x];
+            alive[v] = position[v] = v;
+            label[v] = v;
+        }
+        auto pick = [&rng](long long total) {
+            return std::uniform_int_distribution<long long>(0, total - 1)(rng);
+        };
+        for (int count = node_num; count > target; count--) {
+            long long total = 0;
+            for (int i = 0; i < count; i++)
+                total += degree[alive[i]];
+            long long r = pick(total);
+            int u = alive[0];
+            for (int i = 0; i < count; i++) {
+                u = alive[i];
+                if (r < degree[u]) break;
+                r -= degree[u];
+            }
+            long long *row = matrix.data() + (size_t) u * node_num;
+            r = pick(degree[u]);
+            int v = alive[0];
+            for (int i = 0; i < count; i++) {
+                v = alive[i];
+                if (r < row[v]) break;
+                r -= row[v];
+            }
+            // merge v into u
+            const long long *merged = matrix.data() + (size_t) v * node_num;
+            degree[u] += degree[v] - 2 * row[v];
+            for (int i = 0; i < count; i++) {
+                int x = alive[i];
+                if (x == u || x == v) continue;
+                row[x] += merged[x];
+                matrix[(size_t) x * node_num + u] = row[x];
+            }
+            row[v] = 0;
+            label[v] = u;
+            int last = alive[count - 1];
+            alive[position[v]] = last;
+            position[last] = position[v];
+        }
+        // merged nodes point at the node they went into; follow that chain to a survivor
+        std::vector<int> index(node_num, -1);
+        for (int i = 0; i < target; i++)
+            index[alive[i]] = i;
+        for (int v = 0; v < node_num; v++) {
+            int root = v;
+            while (index[root] == -1)
+                root = label[root];
+            position[v] = index[root];
+        }
+        label.swap(position);
+        std::vector<long long> compact((size_t) target * target);
+        for (int i = 0; i < target; i++)
+            for (int j = 0; j < target; j++)
+                compact[(size_t) i * target + j] = i == j ? 0 : matrix[(size_t) alive[i] * node_num + alive[j]];
+        matrix.swap(compact);
+    }
+
+    long long denseContraction(std::vector<long long> matrix, int node_num, std::mt19937_64 &rng,
+                               std::vector<char> &side) {
+        if (node_num <= 6) {
+            std::vector<WeightedPair> pairs;
+            for (int a = 0; a < node_num; a++)
+                for (int b = a + 1; b < node_num; b++)
+                    if (matrix[(size_t) a * node_num + b] > 0)
+                        pairs.push_back({a, b, matrix[(size_t) a * node_num + b]});
+            return bruteForce(pairs, node_num, side);
+        }
+        int target = std::min(node_num - 1, (int) std::ceil(node_num / std::sqrt(2.0) + 1));
+        long long best = LLONG_MAX;
+        std::vector<int> label(node_num);
+        std::vector<char> inner;
+        side.assign(node_num, 0);
+        for (int repeat = 0; repeat < 2; repeat++) {
+            auto contracted = matrix;
+            contractDense(contracted, node_num, target, rng, label);
+            long long weight = denseContraction(std::move(contracted), target, rng, inner);
+            if (weight < best) {
+                best = weight;
+                for (int v = 0; v < node_num; v++)
+                    side[v] = inner[label[v]];
+            }
+        }
+        return best;
+    }
+
+    long long recursiveContraction(const std::vector<WeightedPair> &pairs, int node_num, std::mt19937_64 &rng,
+                                   std::vector<char> &side) {
+        if (node_num <= denseLimit) {
+            std::vector<long long> matrix((size_t) node_num * node_num, 0);
+            for (auto &pair: pairs) {
+                matrix[(size_t) pair.a * node_num + pair.b] += pair.weight;
+                matrix[(size_t) pair.b * node_num + pair.a] += pair.weight;
+            }
+            return denseContraction(std::move(matrix), node_num, rng, side);
+        }
+        int target = std::min(node_num - 1, (int) std::ceil(node_num / std::sqrt(2.0) + 1));
+        long long best = LLONG_MAX;
+        std::vector<int> label;
+        std::vector<char> inner;
+        side.assign(node_num, 0);
+        for (int repeat = 0; repeat < 2; repeat++) {
+            auto contracted = contract(pairs, node_num, target, rng, label);
+            long long weight = recursiveContraction(contracted, target, rng, inner);
+            if (weight < best) {
+                best = weight;
+                for (int v = 0; v < node_num; v++)
+                    side[v] = inner[label[v]];
+            }
+        }
+        return best;
+    }
+
+    long long stoerWagnerPairs(const std::vector<WeightedPair> &pairs, int n, std::vector<char> &side) {
+        std::vector<std::unordered_map<int, long long>> adjacent(n);
+        for (auto &pair: pairs) {
+            adjacent[pair.a][pair.b] += pair.weight;
+            adjacent[pair.b][pair.a] += pair.weight;
+        }
+        std::vector<std::vector<int>> members(n);
+        std::vector<int> alive(n);
+        for (int v = 0; v < n; v++) {
+            members[v].push_back(v);
+            alive[v] = v;
+        }
+        std::vector<long long> key(n, 0);
+        std::vector<char> added(n, 0);
+        long long best = LLONG_MAX;
+        std::vector<int> best_members;
+
+        while (alive.size() > 1) {
+            std::priority_queue<std::pair<long long, int>> heap;
+            heap.emplace(0, alive.front());
+            int previous = -1, last = -1;
+            for (size_t count = 0; count < alive.size(); count++) {
+                while (added[heap.top().second] || heap.top().first != key[heap.top().second])
+                    heap.pop();
+                int v = heap.top().second;
+                heap.pop();
+                added[v] = 1;
+                previous = last;
+                last = v;
+                for (auto &next: adjacent[v])
+                    if (!added[next.first]) {
+                        key[next.first] += next.second;
+                        heap.emplace(key[next.first], next.first);
+                    }
+            }
+            if (key[last] < best) {
+                best = key[last];
+                best_members = members[last];
+            }
+
+            // merge the last node of the phase into the one added before it
+            for (auto &next: adjacent[last]) {
+                if (next.first == previous) continue;
+                adjacent[previous][next.first] += next.second;
+                adjacent[next.first][previous] += next.second;
+                adjacent[next.first].erase(last);
+            }
+            adjacent[previous].erase(last);
+            adjacent[last].clear();
+            members[previous].insert(members[previous].end(), members[last].begin(), members[last].end());
+            alive.erase(std::find(alive.begin(), alive.end(), last));
+            for (int v: alive) {
+                key[v] = 0;
+                added[v] = 0;
+            }
+        }
+        side.assign(n, 0);
+        for (int v: best_members)
+            side[v] = 1;
+        return best;
+    }
+
+    long long kargerSteinPairs(const std::vector<WeightedPair> &pairs, int n, int trials, unsigned seed,
+                               std::vector<char> &side) {
+        if (trials <= 0) {
+            int log = (int) std::ceil(std::log2((double) n));
+            trials = std::max(1, log * log);
+        }
+        std::vector<long long> weights(trials);
+        std::vector<std::vector<char>> sides(trials);
+        Parallel::forDynamic(trials, [&](int, int trial) {
+            std::mt19937_64 rng(seed + trial);
+            weights[trial] = recursiveContraction(pairs, n, rng, sides[trial]);
+        });
+        int best = (int) (std::min_element(weights.begin(), weights.end()) - weights.begin());
+        side = sides[best];
+        return weights[best];
+    }
+}
+
+GlobalCut MinCutEngine::stoerWagner(const CompactGraph &graph) {
+    return solve(graph, true, stoerWagnerPairs);
+}
+
+GlobalCut MinCutEngine::kargerStein(const CompactGraph &graph, int trials, unsigned seed) {
+    return solve(graph, false, [trials, seed](const std::vector<WeightedPair> &pairs, int n, std::vector<char> &side) {
+        return kargerSteinPairs(pairs, n, trials, seed, side);
+    });
+}
+
+GlobalCut MinCutEngine::minimumCut(const CompactGraph &graph, int trials) {
+    bool exact = true;
+    auto cut = solve(graph, true, [trials, &exact](const std::vector<WeightedPair> &pairs, int n,
+                                                   std::vector<char> &side) {
+        if (n <= stoerWagnerLimit)
+            return stoerWagnerPairs(pairs, n, side);
+        exact = false;
+        return kargerSteinPairs(pairs, n, trials, 1, side);
+    });
+    cut.exact = exact;
+    return cut;
+}
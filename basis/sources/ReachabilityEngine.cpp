@@ -0,0 +1,154 @@
+#include "basis/headers/ReachabilityEngine.h"
+#include <algorithm>
+#include <utility>
+
+using namespace GraphType;
+
+namespace {
+
+    void buildRows(int node_num, const std::vector<std::pair<int, int>> &arcs, bool reversed,
+                   std::vector<int> &offsets, std::vector<int> &targets) {
+        offsets.assign(node_num + 1, 0);
+        for (auto &arc: arcs)
+            offsets[(reversed ? arc.second : arc.first) + 1]++;
+        for (int i = 0; i < node_num; i++)
+            offsets[i + 1] += offsets[i];
+        targets.resize(arcs.size());
+        std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+        for (auto &arc: arcs) {
+            if (reversed)
+                targets[cursor[arc.second]++] = arc.first;
+            else
+                targets[cursor[arc.first]++] = arc.second;
+        }
+    }
+
+    bool intersects(const int *a, const int *a_end, const int *b, const int *b_end) {
+        while (a != a_end && b != b_end) {
+            if (*a == *b) return true;
+            if (*a < *b) ++a;
+            else ++b;
+        }
+        return false;
+    }
+
+    bool intersects(const std::vector<int> &a, const std::vector<int> &b) {
+        return intersects(a.data(), a.data() + a.size(), b.data(), b.data() + b.size());
+    }
+
+    void flatten(const std::vector<std::vector<int>> &labels, std::vector<int> &offsets, std::vector<int> &hubs) {
+        offsets.assign(labels.size() + 1, 0);
+        for (size_t i = 0; i < labels.size(); i++)
+            offsets[i + 1] = offsets[i] + (int) labels[i].size();
+        hubs.reserve(offsets.back());
+        for (auto &label: labels)
+            hubs.insert(hubs.end(), label.begin(), label.end());
+    }
+}
+
+bool ReachabilityIndex::reaches(int u, int v) const {
+    int a = component[u], b = component[v];
+    if (a == b) return true;
+    // every arc of the condensation climbs at least one level
+    if (level[a] >= level[b]) return false;
+    return intersects(outHubs.data() + outOffsets[a], outHubs.data() + outOffsets[a + 1],
+                      inHubs.data() + inOffsets[b], inHubs.data() + inOffsets[b + 1]);
+}
+
+ReachabilityIndex ReachabilityEngine::build(const CompactGraph &graph, const ComponentLabels &components) {
+    ReachabilityIndex index;
+    index.component = components.component;
+    int n = components.count;
+
+    std::vector<std::pair<int, int>> arcs;
+    for (auto &edge: graph.edges()) {
+        int a = index.component[edge.u], b = index.component[edge.v];
+        if (a != b)
+            arcs.emplace_back(a, b);
+    }
+    std::sort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    std::vector<int> out_offsets, out_targets, in_offsets, in_sources;
+    buildRows(n, arcs, false, out_offsets, out_targets);
+    buildRows(n, arcs, true, in_offsets, in_sources);
+
+    // component ids are topological, so sorted arcs settle every predecessor of a level first
+    index.level.assign(n, 0);
+    for (auto &arc: arcs)
+        index.level[arc.second] = std::max(index.level[arc.second], index.level[arc.first] + 1);
+
+    std::vector<int> order(n);
+    std::vector<long long> weight(n);
+    for (int c = 0; c < n; c++) {
+        order[c] = c;
+        weight[c] = (long long) (out_offsets[c + 1] - out_offsets[c] + 1) * (in_offsets[c + 1] - in_offsets[c] + 1);
+    }
+    std::stable_sort(order.begin(), order.end(), [&weight](int a, int b) { return weight[a] > weight[b]; });
+
+    std::vector<std::vector<int>> out_labels(n), in_labels(n);
+    std::vector<int> stamp(n, -1), queue;
+    queue.reserve(n);
+    for (int rank = 0; rank < n; rank++) {
+        int hub = order[rank];
+        for (int pass = 0; pass < 2; pass++) {
+            bool forward = pass == 0;
+            auto &offsets = forward ? out_offsets : in_offsets;
+            auto &targets = forward ? out_targets : in_sources;
+            queue.assign(1, hub);
+            stamp[hub] = 2 * rank + pass;
+            for (size_t head = 0; head < queue.size(); head++) {
+                int c = queue[head];
+                if (c != hub && (forward ? intersects(out_labels[hub], in_labels[c])
+                                         : intersects(out_labels[c], in_labels[hub])))
+                    continue;
+                (forward ? in_labels[c] : out_labels[c]).push_back(rank);
+                for (int i = offsets[c]; i < offsets[c + 1]; i++) {
+                    int next = targets[i];
+                    if (stamp[next] != 2 * rank + pass) {
+                        stamp[next] = 2 * rank + pass;
+                        queue.push_back(next);
+                    }
+                }
+            }
+        }
+    }
+    flatten(out_labels, index.outOffsets, index.outHubs);
+    flatten(in_labels, index.inOffsets, index.inHubs);
+    return index;
+}
+
+ReachabilityIndex ReachabilityEngine::build(const CompactGraph &graph) {
+    return build(graph, ComponentEngine::stronglyConnected(graph));
+}
+
+bool ReachabilityEngine::bidirectionalSearch(const CompactGraph &graph, int u, int v) {
+    if (u == v) return true;
+    std::vector<char> side(graph.countNodes(), 0);
+    std::vector<int> forward(1, u), backward(1, v), next;
+    side[u] = 1;
+    side[v] = 2;
+    long long forward_work = graph.outDegree(u), backward_work = graph.inDegree(v);
+    while (!forward.empty() && !backward.empty()) {
+        // expand whichever frontier has fewer arcs to scan
+        bool grow_forward = forward_work <= backward_work;
+        auto &frontier = grow_forward ? forward : backward;
+        char own = grow_forward ? 1 : 2, other = grow_forward ? 2 : 1;
+        long long work = 0;
+        next.clear();
+        for (int w: frontier) {
+            int begin = grow_forward ? graph.outBegin(w) : graph.inBegin(w);
+            int end = grow_forward ? graph.outEnd(w) : graph.inEnd(w);
+            for (int i = begin; i < end; i++) {
+                int x = grow_forward ? graph.target(i) : graph.source(i);
+                if (side[x] == other) return true;
+                if (side[x] == own) continue;
+                side[x] = own;
+                next.push_back(x);
+                work += grow_forward ? graph.outDegree(x) : graph.inDegree(x);
+            }
+        }
+        frontier.swap(next);
+        (grow_forward ? forward_work : backward_work) = work;
+    }
+    return false;
+}
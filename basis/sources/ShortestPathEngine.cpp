@@ -0,0 +1,132 @@
+#include "basis/headers/ShortestPathEngine.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+using namespace GraphType;
+
+namespace {
+    struct RelaxRequest {
+        int v;
+        int parent;
+        long long dist;
+    };
+
+    const long long kMaxBuckets = 1 << 16;
+}
+
+ShortestPathTree ShortestPathEngine::dijkstra(const CompactGraph &graph, int source, int goal) {
+    int n = graph.countNodes();
+    ShortestPathTree tree{std::vector<long long>(n, LLONG_MAX), std::vector<int>(n, -1)};
+    if (source < 0 || source >= n) return tree;
+
+    typedef std::pair<long long, int> QueueItem;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> pq;
+    std::vector<bool> done(n, false);
+    tree.dist[source] = 0;
+    pq.emplace(0, source);
+    while (!pq.empty()) {
+        int u = pq.top().second;
+        pq.pop();
+        if (done[u]) continue;
+        done[u] = true;
+        if (u == goal) break;
+        for (int a = graph.outBegin(u); a < graph.outEnd(u); a++) {
+            int v = graph.target(a);
+            long long nd = tree.dist[u] + graph.weight(a);
+            if (!done[v] && nd < tree.dist[v]) {
+                tree.dist[v] = nd;
+                tree.parent[v] = u;
+                pq.emplace(nd, v);
+            }
+        }
+    }
+    return tree;
+}
+
+ShortestPathTree ShortestPathEngine::deltaStepping(const CompactGraph &graph, int source, long long delta) {
+    int n = graph.countNodes();
+    ShortestPathTree tree{std::vector<long long>(n, LLONG_MAX), std::vector<int>(n, -1)};
+    if (source < 0 || source >= n) return tree;
+    auto &dist = tree.dist;
+    auto &parent = tree.parent;
+
+    long long max_weight = std::max(1, graph.maxWeight());
+    if (delta <= 0)
+        delta = std::max(1LL, max_weight * n / std::max(1, graph.countArcs()));
+    delta = std::max(delta, (max_weight + kMaxBuckets - 1) / kMaxBuckets);
+
+    // live entries always lie within max_weight / delta + 1 buckets of the current one,
+    // so a cyclic array of that many slots never aliases two live buckets
+    auto slots = max_weight / delta + 2;
+    std::vector<std::vector<int>> buckets(slots);
+    long long queued = 0;
+    auto push = [&](int v) {
+        buckets[(dist[v] / delta) % slots].push_back(v);
+        queued++;
+    };
+
+    std::vector<std::vector<RelaxRequest>> requests(Parallel::threadCount());
+    auto relax = [&](const std::vector<int> &frontier, bool light) {
+        Parallel::forBlocks((int) frontier.size(), [&](int tid, int begin, int end) {
+            auto &out = requests[tid];
+            for (int i = begin; i < end; i++) {
+                int u = frontier[i];
+                for (int a = graph.outBegin(u); a < graph.outEnd(u); a++) {
+                    long long w = graph.weight(a);
+                    if ((w <= delta) != light) continue;
+                    int v = graph.target(a);
+                    if (dist[u] + w < dist[v])
+                        out.push_back({v, u, dist[u] + w});
+                }
+            }
+        }, 256);
+        for (auto &out: requests) {
+            for (auto &r: out) {
+                if (r.dist < dist[r.v]) {
+                    dist[r.v] = r.dist;
+                    parent[r.v] = r.parent;
+                    push(r.v);
+                }
+            }
+            out.clear();
+        }
+    };
+
+    std::vector<long long> settled_in(n, -1);
+    std::vector<int> phase_mark(n, -1);
+    std::vector<int> pending, frontier, settled;
+    int phase = 0;
+    dist[source] = 0;
+    push(source);
+    for (long long cur = 0; queued > 0; cur++) {
+        auto &bucket = buckets[cur % slots];
+        settled.clear();
+        while (!bucket.empty()) {
+            pending.clear();
+            pending.swap(bucket);
+            queued -= (long long) pending.size();
+            frontier.clear();
+            phase++;
+            for (int v: pending) {
+                if (dist[v] / delta != cur || phase_mark[v] == phase) continue;
+                phase_mark[v] = phase;
+                frontier.push_back(v);
+                if (settled_in[v] != cur) {
+                    settled_in[v] = cur;
+                    settled.push_back(v);
+                }
+            }
+            relax(frontier, true);
+        }
+        relax(settled, false);
+    }
+    return tree;
+}
+
+ShortestPathTree ShortestPathEngine::run(const CompactGraph &graph, int source, ShortestPathBackend backend) {
+    if (backend == ShortestPathBackend::DeltaStepping)
+        return deltaStepping(graph, source);
+    return dijkstra(graph, source);
+}
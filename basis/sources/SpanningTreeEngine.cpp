@@ -0,0 +1,154 @@
+#include "basis/headers/SpanningTreeEngine.h"
+#include "utils/parallel.h"
+#include "utils/unionfind.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <functional>
+#include <numeric>
+#include <queue>
+
+using namespace GraphType;
+
+namespace {
+    std::vector<int> radixSortByWeight(const std::vector<CompactEdge> &edges) {
+        std::vector<int> order(edges.size()), buffer(edges.size());
+        std::iota(order.begin(), order.end(), 0);
+        for (int shift = 0; shift < 32; shift += 8) {
+            std::vector<int> count(257, 0);
+            for (int e: order)
+                count[((unsigned) edges[e].weight >> shift & 0xff) + 1]++;
+            if (*std::max_element(count.begin(), count.end()) == (int) order.size())
+                continue;
+            for (int d = 0; d < 256; d++)
+                count[d + 1] += count[d];
+            for (int e: order)
+                buffer[count[(unsigned) edges[e].weight >> shift & 0xff]++] = e;
+            order.swap(buffer);
+        }
+        return order;
+    }
+
+    void atomicMin(std::atomic<unsigned long long> &target, unsigned long long value) {
+        auto current = target.load(std::memory_order_relaxed);
+        while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed));
+    }
+}
+
+SpanningForest SpanningTreeEngine::kruskal(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    SpanningForest forest;
+    UnionFind sets(n);
+    for (int e: radixSortByWeight(graph.edges())) {
+        if ((int) forest.edges.size() == n - 1) break;
+        auto &edge = graph.edge(e);
+        if (sets.unite(edge.u, edge.v)) {
+            forest.edges.push_back(e);
+            forest.cost += edge.weight;
+        }
+    }
+    forest.components = n - (int) forest.edges.size();
+    return forest;
+}
+
+SpanningForest SpanningTreeEngine::boruvka(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    const auto none = ULLONG_MAX;
+    SpanningForest forest;
+    UnionFind sets(n);
+    std::vector<int> comp(n);
+    std::vector<std::atomic<unsigned long long>> best(n);
+    std::vector<int> live(graph.countEdges());
+    std::iota(live.begin(), live.end(), 0);
+    std::vector<std::vector<int>> kept(Parallel::threadCount());
+
+    while (!live.empty()) {
+        for (int v = 0; v < n; v++) {
+            comp[v] = sets.find(v);
+            best[v].store(none, std::memory_order_relaxed);
+        }
+        // (weight, edge id) keys are unique, so every component picks a consistent cheapest edge
+        Parallel::forBlocks((int) live.size(), [&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                auto &edge = graph.edge(live[i]);
+                int cu = comp[edge.u], cv = comp[edge.v];
+                if (cu == cv) continue;
+                auto key = (unsigned long long) edge.weight << 32 | (unsigned) live[i];
+                atomicMin(best[cu], key);
+                atomicMin(best[cv], key);
+            }
+        });
+
+        bool merged = false;
+        for (int v = 0; v < n; v++) {
+            auto key = best[v].load(std::memory_order_relaxed);
+            if (comp[v] != v || key == none) continue;
+            int e = (int) (key & 0xffffffffULL);
+            if (sets.unite(graph.edge(e).u, graph.edge(e).v)) {
+                forest.edges.push_back(e);
+                forest.cost += graph.edge(e).weight;
+                merged = true;
+            }
+        }
+        if (!merged) break;
+
+        for (int v = 0; v < n; v++)
+            comp[v] = sets.find(v);
+        Parallel::forBlocks((int) live.size(), [&](int tid, int begin, int end) {
+            for (int i = begin; i < end; i++)
+                if (comp[graph.edge(live[i]).u] != comp[graph.edge(live[i]).v])
+                    kept[tid].push_back(live[i]);
+        });
+        live.clear();
+        for (auto &part: kept) {
+            live.insert(live.end(), part.begin(), part.end());
+            part.clear();
+        }
+    }
+    forest.components = n - (int) forest.edges.size();
+    return forest;
+}
+
+SpanningForest SpanningTreeEngine::prim(const CompactGraph &graph, int source) {
+    int n = graph.countNodes();
+    SpanningForest forest;
+    forest.components = n;
+    if (source < 0 || source >= n) return forest;
+
+    // items are (weight, edge id); the edge's far end is whichever end is not yet in the tree
+    typedef std::pair<int, int> QueueItem;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> pq;
+    std::vector<bool> inTree(n, false);
+    auto expand = [&](int u) {
+        inTree[u] = true;
+        for (int a = graph.outBegin(u); a < graph.outEnd(u); a++)
+            if (!inTree[graph.target(a)])
+                pq.emplace(graph.weight(a), graph.arcEdge(a));
+        // arcs into u are edges of the undirected graph too
+        if (graph.isDirected())
+            for (int a = graph.inBegin(u); a < graph.inEnd(u); a++)
+                if (!inTree[graph.source(a)])
+                    pq.emplace(graph.inWeight(a), graph.inArcEdge(a));
+    };
+    expand(source);
+    while (!pq.empty()) {
+        int e = pq.top().second;
+        pq.pop();
+        auto &edge = graph.edge(e);
+        if (inTree[edge.u] && inTree[edge.v]) continue;
+        forest.edges.push_back(e);
+        forest.cost += edge.weight;
+        expand(inTree[edge.u] ? edge.v : edge.u);
+    }
+    UnionFind sets(n);
+    for (auto &edge: graph.edges())
+        sets.unite(edge.u, edge.v);
+    forest.components = sets.countSets();
+    return forest;
+}
+
+SpanningForest SpanningTreeEngine::minimumSpanningForest(const CompactGraph &graph) {
+    if (Parallel::threadCount() > 1 && graph.countEdges() >= (1 << 16))
+        return boruvka(graph);
+    return kruskal(graph);
+}
@@ -0,0 +1,70 @@
+#include "basis/headers/TopologicalEngine.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+using namespace GraphType;
+
+namespace {
+    // every node left over still has an unreleased predecessor, so walking predecessors must repeat a node
+    std::vector<int> findCycle(const CompactGraph &graph, const std::vector<int> &level) {
+        int n = graph.countNodes();
+        std::vector<int> position(n, -1), walk;
+        int v = 0;
+        while (level[v] != -1) v++;
+        while (position[v] == -1) {
+            position[v] = (int) walk.size();
+            walk.push_back(v);
+            for (int a = graph.inBegin(v); a < graph.inEnd(v); a++) {
+                if (level[graph.source(a)] == -1) {
+                    v = graph.source(a);
+                    break;
+                }
+            }
+        }
+        std::vector<int> cycle(walk.rbegin(), walk.rend() - position[v]);
+        cycle.insert(cycle.begin(), v);
+        return cycle;
+    }
+}
+
+TopologicalOrder TopologicalEngine::sort(const CompactGraph &graph) {
+    int n = graph.countNodes();
+    TopologicalOrder result;
+    result.level.assign(n, -1);
+    std::unique_ptr<std::atomic<int>[]> remaining(new std::atomic<int>[n]);
+    std::vector<int> frontier;
+    for (int v = 0; v < n; v++) {
+        remaining[v].store(graph.inDegree(v), std::memory_order_relaxed);
+        if (graph.inDegree(v) == 0)
+            frontier.push_back(v);
+    }
+
+    std::vector<std::vector<int>> released(Parallel::threadCount());
+    while (!frontier.empty()) {
+        int depth = (int) result.levels.size();
+        for (int v: frontier)
+            result.level[v] = depth;
+        Parallel::forBlocks((int) frontier.size(), [&](int tid, int begin, int end) {
+            auto &next = released[tid];
+            for (int i = begin; i < end; i++) {
+                int v = frontier[i];
+                for (int a = graph.outBegin(v); a < graph.outEnd(v); a++)
+                    if (remaining[graph.target(a)].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        next.push_back(graph.target(a));
+            }
+        }, 512);
+        result.order.insert(result.order.end(), frontier.begin(), frontier.end());
+        result.levels.push_back(std::move(frontier));
+        frontier.clear();
+        for (auto &next: released) {
+            frontier.insert(frontier.end(), next.begin(), next.end());
+            next.clear();
+        }
+    }
+
+    if ((int) result.order.size() < n)
+        result.cycle = findCycle(graph, result.level);
+    return result;
+}
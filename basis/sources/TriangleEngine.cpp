@@ -0,0 +1,128 @@
+#include "basis/headers/TriangleEngine.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+using namespace GraphType;
+
+namespace {
+
+    // rows this many times longer than the other are searched instead of merged
+    const int gallopRatio = 32;
+
+    // Calls found(w) for every w in both sorted ranges
+    template<class Found>
+    void intersect(const int *a, const int *a_end, const int *b, const int *b_end, Found found) {
+        if (a_end - a > b_end - b) {
+            std::swap(a, b);
+            std::swap(a_end, b_end);
+        }
+        if ((b_end - b) > gallopRatio * (a_end - a)) {
+            for (; a < a_end && b < b_end; a++) {
+                b = std::lower_bound(b, b_end, *a);
+                if (b < b_end && *b == *a)
+                    found(*a);
+            }
+            return;
+        }
+        while (a < a_end && b < b_end) {
+            int x = *a, y = *b;
+            if (x == y)
+                found(x);
+            a += x <= y;
+            b += y <= x;
+        }
+    }
+}
+
+TriangleCount TriangleEngine::count(const CompactGraph &graph) {
+    TriangleCount result;
+    int n = graph.countNodes();
+    result.local.assign(n, 0);
+    result.degree.assign(n, 0);
+    result.clustering.assign(n, 0);
+    if (n == 0) return result;
+
+    Parallel::forBlocks(n, [&](int, int begin, int end) {
+        for (int v = begin; v < end; v++)
+            graph.forSimpleNeighbours(v, [&](int, int) { result.degree[v]++; });
+    });
+
+    // rank[v] orders nodes by degree, ties by id; rows are stored by rank
+    std::vector<int> order(n), rank(n);
+    for (int v = 0; v < n; v++)
+        order[v] = v;
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return result.degree[a] != result.degree[b] ? result.degree[a] < result.degree[b] : a < b;
+    });
+    for (int r = 0; r < n; r++)
+        rank[order[r]] = r;
+
+    std::vector<long long> offsets(n + 1, 0);
+    Parallel::forBlocks(n, [&](int, int begin, int end) {
+        for (int r = begin; r < end; r++)
+            graph.forSimpleNeighbours(order[r], [&](int w, int) {
+                if (rank[w] > r) offsets[r + 1]++;
+            });
+    });
+    for (int r = 0; r < n; r++)
+        offsets[r + 1] += offsets[r];
+    std::vector<int> higher(offsets[n]);
+    Parallel::forBlocks(n, [&](int, int begin, int end) {
+        for (int r = begin; r < end; r++) {
+            long long next = offsets[r];
+            graph.forSimpleNeighbours(order[r], [&](int w, int) {
+                if (rank[w] > r) higher[next++] = rank[w];
+            });
+            std::sort(higher.begin() + offsets[r], higher.begin() + offsets[r + 1]);
+        }
+    });
+
+    // the lowest corner of a triangle counts it locally; the other two corners are shared
+    std::unique_ptr<std::atomic<long long>[]> shared(new std::atomic<long long>[n]);
+    for (int r = 0; r < n; r++)
+        shared[r].store(0, std::memory_order_relaxed);
+    std::vector<long long> lowest(n, 0);
+    const int chunk = 256;
+    std::vector<long long> found((n + chunk - 1) / chunk, 0);
+    Parallel::forDynamic((int) found.size(), [&](int, int c) {
+        long long total = 0;
+        for (int u = c * chunk; u < std::min(n, (c + 1) * chunk); u++) {
+            const int *row = higher.data() + offsets[u], *row_end = higher.data() + offsets[u + 1];
+            long long here = 0;
+            for (const int *p = row; p < row_end; p++) {
+                int v = *p;
+                long long through_v = 0;
+                intersect(p + 1, row_end, higher.data() + offsets[v], higher.data() + offsets[v + 1],
+                          [&](int w) {
+                              through_v++;
+                              shared[w].fetch_add(1, std::memory_order_relaxed);
+                          });
+                if (through_v > 0)
+                    shared[v].fetch_add(through_v, std::memory_order_relaxed);
+                here += through_v;
+            }
+            lowest[u] = here;
+            total += here;
+        }
+        found[c] = total;
+    });
+    for (long long value: found)
+        result.triangles += value;
+
+    long long triples = 0;
+    double sum = 0;
+    for (int v = 0; v < n; v++) {
+        int r = rank[v];
+        result.local[v] = lowest[r] + shared[r].load(std::memory_order_relaxed);
+        long long d = result.degree[v];
+        triples += d * (d - 1) / 2;
+        if (d >= 2)
+            result.clustering[v] = 2.0 * result.local[v] / (d * (d - 1));
+        sum += result.clustering[v];
+    }
+    result.transitivity = triples > 0 ? 3.0 * result.triangles / triples : 0;
+    result.averageClustering = sum / n;
+    return result;
+}
@@ -0,0 +1,212 @@
+// Times Dinic against push-relabel on DIMACS max-flow instances, or on generated ones when no file
+// is given. Built only with -DBUILD_BENCHMARKS=ON; usage: max_flow_benchmark [runs] [instance.max...]
+
+#include "basis/headers/CompactGraph.h"
+#include "basis/headers/FlowEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace GraphType;
+
+namespace {
+
+    struct Instance {
+        std::unique_ptr<Graph> graph;
+        std::string source, sink;
+    };
+
+    // Nodes are named 1..n; parallel arcs are merged by adding their capacities, self-loops and
+    // zero capacities are dropped since Graph cannot hold them
+    class Network {
+    public:
+        explicit Network(int nodes) {
+            _instance.graph.reset(new Graph(true, true));
+            for (int i = 1; i <= nodes; i++) {
+                _instance.graph->addNode(std::to_string(i));
+                _nodes.push_back(_instance.graph->node(std::to_string(i)));
+            }
+        }
+
+        int countNodes() const { return (int) _nodes.size(); }
+
+        void addArc(int u, int v, long long capacity) {
+            if (u == v || capacity <= 0) return;
+            auto &graph = *_instance.graph;
+            Node *from = _nodes[u - 1], *to = _nodes[v - 1];
+            long long total = capacity + (graph.hasEdge(from, to) ? graph.weight(from, to) : 0);
+            graph.setEdge(from, to, (int) std::min<long long>(total, INT_MAX - 1));
+        }
+
+        Instance finish(int source, int sink) {
+            _instance.source = std::to_string(source);
+            _instance.sink = std::to_string(sink);
+            return std::move(_instance);
+        }
+
+    private:
+        Instance _instance;
+        std::vector<Node *> _nodes;
+    };
+
+    // Reads the DIMACS max-flow format: "p max n m", "n id s", "n id t", "a u v capacity"
+    bool readDimacs(const std::string &path, Instance &instance) {
+        std::ifstream in(path);
+        if (!in) {
+            std::fprintf(stderr, "%s: cannot open\n", path.c_str());
+            return false;
+        }
+        std::unique_ptr<Network> network;
+        int source = 0, sink = 0, line_number = 0;
+        std::string line;
+        while (std::getline(in, line)) {
+            line_number++;
+            std::istringstream fields(line);
+            char kind = 0;
+            if (!(fields >> kind) || kind == 'c') continue;
+            bool ok = false;
+            if (kind == 'p') {
+                std::string problem;
+                int n = 0, m = 0;
+                ok = !network && fields >> problem >> n >> m && problem == "max" && n > 0;
+                if (ok) network.reset(new Network(n));
+            } else if (kind == 'n' && network) {
+                int id = 0;
+                char role = 0;
+                ok = fields >> id >> role && id >= 1 && id <= network->countNodes() && (role == 's' || role == 't');
+                if (ok) (role == 's' ? source : sink) = id;
+            } else if (kind == 'a' && network) {
+                int u = 0, v = 0;
+                long long capacity = 0;
+                ok = fields >> u >> v >> capacity && u >= 1 && v >= 1
+                     && u <= network->countNodes() && v <= network->countNodes();
+                if (ok) network->addArc(u, v, capacity);
+            }
+            if (!ok) {
+                std::fprintf(stderr, "%s:%d: malformed line\n", path.c_str(), line_number);
+                return false;
+            }
+        }
+        if (!network || source == 0 || sink == 0 || source == sink) {
+            std::fprintf(stderr, "%s: missing problem line, source or sink\n", path.c_str());
+            return false;
+        }
+        instance = network->finish(source, sink);
+        return true;
+    }
+
+    // GENRMF-style network: `frames` square grids of side x side nodes whose in-frame arcs have
+    // capacity 100 * side * side, joined frame to frame by a random permutation of arcs with capacity
+    // 1..100. The source is a corner of the first frame, the sink the opposite corner of the last.
+    Instance gridFrames(int side, int frames, unsigned seed) {
+        int area = side * side;
+        Network network(area * frames);
+        std::mt19937 rng(seed);
+        std::vector<int> order(area);
+        for (int f = 0; f < frames; f++) {
+            int base = f * area + 1;
+            for (int r = 0; r < side; r++)
+                for (int c = 0; c < side; c++) {
+                    int v = base + r * side + c;
+                    if (c + 1 < side) {
+                        network.addArc(v, v + 1, 100LL * area);
+                        network.addArc(v + 1, v, 100LL * area);
+                    }
+                    if (r + 1 < side) {
+                        network.addArc(v, v + side, 100LL * area);
+                        network.addArc(v + side, v, 100LL * area);
+                    }
+                }
+            if (f + 1 == frames) continue;
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), rng);
+            for (int i = 0; i < area; i++)
+                network.addArc(base + i, base + area + order[i], 1 + (int) (rng() % 100));
+        }
+        return network.finish(1, area * frames);
+    }
+
+    // Random layered network: `layers` layers of `width` nodes, each node with `degree` arcs of
+    // capacity 1..10000 into the next layer; the source feeds the first layer, the last drains
+    // into the sink
+    Instance randomLayers(int width, int layers, int degree, unsigned seed) {
+        Network network(width * layers + 2);
+        std::mt19937 rng(seed);
+        int source = width * layers + 1, sink = source + 1;
+        for (int i = 1; i <= width; i++) {
+            network.addArc(source, i, 1 + (int) (rng() % 10000));
+            network.addArc(width * (layers - 1) + i, sink, 1 + (int) (rng() % 10000));
+        }
+        for (int l = 0; l + 1 < layers; l++)
+            for (int i = 1; i <= width; i++)
+                for (int k = 0; k < degree; k++)
+                    network.addArc(l * width + i, (l + 1) * width + 1 + (int) (rng() % width),
+                                   1 + (int) (rng() % 10000));
+        return network.finish(source, sink);
+    }
+
+    template<class Fn>
+    double bestMilliseconds(int runs, Fn fn) {
+        double best = 0;
+        for (int r = 0; r < runs; r++) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best = r == 0 ? ms : std::min(best, ms);
+        }
+        return best;
+    }
+
+    void run(const std::string &title, const Instance &instance, int runs) {
+        CompactGraph compact(*instance.graph);
+        int source = compact.id(instance.source), sink = compact.id(instance.sink);
+        std::printf("%s: %d nodes, %d arcs\n", title.c_str(), compact.countNodes(), compact.countEdges());
+        long long value = -1;
+        double dinic = 0;
+        for (auto algorithm: {Dinic, PushRelabel}) {
+            auto result = FlowEngine::maxFlow(compact, source, sink, algorithm);
+            long long cut = 0;
+            for (int e: result.cut)
+                cut += compact.edge(e).weight;
+            if (cut != result.value || (value >= 0 && result.value != value)) {
+                std::printf("  %s: flow %lld, cut %lld, expected %lld\n", algorithm == Dinic ? "dinic" : "push-relabel",
+                            result.value, cut, value);
+                std::exit(1);
+            }
+            value = result.value;
+            double ms = bestMilliseconds(runs, [&]() { FlowEngine::maxFlow(compact, source, sink, algorithm); });
+            if (algorithm == Dinic) {
+                dinic = ms;
+                std::printf("  %-14s %9.1f ms  flow %lld\n", "dinic", ms, value);
+            } else {
+                std::printf("  %-14s %9.1f ms  (%.2fx)\n", "push-relabel", ms, dinic / ms);
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int runs = argc > 1 ? std::max(1, std::atoi(argv[1])) : 3;
+    std::printf("best of %d run(s)\n", runs);
+    if (argc <= 2) {
+        run("grid frames 64x64x16", gridFrames(64, 16, 1), runs);
+        run("random layers 2000x64", randomLayers(2000, 64, 4, 1), runs);
+        return 0;
+    }
+    for (int i = 2; i < argc; i++) {
+        Instance instance;
+        if (!readDimacs(argv[i], instance))
+            return 1;
+        run(argv[i], instance, runs);
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Times binary-heap Dijkstra against delta-stepping on a road-like grid and on a power-law graph.
+// Built only with -DBUILD_BENCHMARKS=ON; usage: shortest_path_benchmark [nodes] [runs] [seed]
+
+#include "basis/headers/CompactGraph.h"
+#include "basis/headers/ShortestPathEngine.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace GraphType;
+
+namespace {
+
+    std::string nodeName(int i) {
+        return "n" + std::to_string(i);
+    }
+
+    // Square grid with 4-neighbour streets of length 1..1000: high diameter, degree at most 4
+    Graph roadGrid(int nodes, unsigned seed) {
+        int side = std::max(2, (int) std::sqrt((double) nodes));
+        Graph graph(false, true);
+        for (int i = 0; i < side * side; i++)
+            graph.addNode(nodeName(i));
+        std::mt19937 rng(seed);
+        for (int r = 0; r < side; r++)
+            for (int c = 0; c < side; c++) {
+                int v = r * side + c;
+                if (c + 1 < side) graph.setEdge(nodeName(v), nodeName(v + 1), 1 + (int) (rng() % 1000));
+                if (r + 1 < side) graph.setEdge(nodeName(v), nodeName(v + side), 1 + (int) (rng() % 1000));
+            }
+        return graph;
+    }
+
+    // Barabasi-Albert preferential attachment, 4 edges per new node with weights 1..1000: low
+    // diameter, hubs of very high degree
+    Graph powerLaw(int nodes, unsigned seed) {
+        const int links = 4;
+        Graph graph(false, true);
+        std::mt19937 rng(seed);
+        // every edge end once, so a uniform pick is proportional to degree
+        std::vector<int> ends;
+        for (int i = 0; i <= links; i++) {
+            graph.addNode(nodeName(i));
+            for (int j = 0; j < i; j++) {
+                graph.setEdge(nodeName(i), nodeName(j), 1 + (int) (rng() % 1000));
+                ends.push_back(i);
+                ends.push_back(j);
+            }
+        }
+        for (int i = links + 1; i < nodes; i++) {
+            graph.addNode(nodeName(i));
+            for (int k = 0; k < links; k++) {
+                int j = ends[rng() % ends.size()];
+                if (graph.setEdge(nodeName(i), nodeName(j), 1 + (int) (rng() % 1000))) {
+                    ends.push_back(i);
+                    ends.push_back(j);
+                }
+            }
+        }
+        return graph;
+    }
+
+    template<class Fn>
+    double bestMilliseconds(int runs, Fn fn) {
+        double best = 0;
+        for (int r = 0; r < runs; r++) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best = r == 0 ? ms : std::min(best, ms);
+        }
+        return best;
+    }
+
+    void run(const char *title, const Graph &graph, int runs) {
+        CompactGraph compact(graph);
+        int n = compact.countNodes();
+        long long max_weight = std::max(1, compact.maxWeight());
+        // the default ShortestPathEngine::deltaStepping picks: max weight / average degree
+        long long delta = std::max(1LL, max_weight * n / std::max(1, compact.countArcs()));
+        std::printf("%s: %d nodes, %d edges, default delta %lld\n", title, n, compact.countEdges(), delta);
+
+        auto reference = ShortestPathEngine::dijkstra(compact, 0);
+        double dijkstra = bestMilliseconds(runs, [&]() { ShortestPathEngine::dijkstra(compact, 0); });
+        std::printf("  %-24s %9.1f ms\n", "dijkstra", dijkstra);
+        std::vector<long long> deltas{std::max(1LL, delta / 4), delta, delta * 4, max_weight};
+        std::sort(deltas.begin(), deltas.end());
+        deltas.erase(std::unique(deltas.begin(), deltas.end()), deltas.end());
+        for (long long d: deltas) {
+            auto tree = ShortestPathEngine::deltaStepping(compact, 0, d);
+            if (tree.dist != reference.dist) {
+                std::printf("  delta-stepping with delta %lld disagrees with dijkstra\n", d);
+                std::exit(1);
+            }
+            double ms = bestMilliseconds(runs, [&]() { ShortestPathEngine::deltaStepping(compact, 0, d); });
+            std::string label = "delta-stepping " + std::to_string(d);
+            std::printf("  %-24s %9.1f ms  (%.2fx)\n", label.c_str(), ms, dijkstra / ms);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int nodes = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int runs = argc > 2 ? std::max(1, std::atoi(argv[2])) : 3;
+    unsigned seed = argc > 3 ? (unsigned) std::atoi(argv[3]) : 1;
+    std::printf("%d worker thread(s), best of %d run(s)\n", Parallel::threadCount(), runs);
+    run("road grid", roadGrid(nodes, seed), runs);
+    run("power law", powerLaw(nodes, seed), runs);
+    return 0;
+}
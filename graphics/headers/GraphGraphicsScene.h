@@ -7,8 +7,9 @@
 #include <QGraphicsScene>
 #include <QtWidgets>
 
+// Ramp colours nodes from pale yellow (lowest score) to dark red (highest score)
 enum GraphDemoFlag {
-    OnlyNode, OnlyEdge, EdgeAndNode, Component, Coloring
+    OnlyNode, OnlyEdge, EdgeAndNode, Component, Coloring, Ramp
 };
 
 class GraphGraphicsScene : public QGraphicsScene {
@@ -44,6 +45,13 @@ public slots:
 
     void demoAlgorithm(const std::list<std::list<std::string>> &listOfListToDemo, GraphDemoFlag flag);
 
+    void demoAlgorithm(const std::list<std::pair<std::string, double>> &listOfScoreToDemo, GraphDemoFlag flag);
+
+    // Draws only the listed nodes and the edges between them until the next reload or clearFilter
+    void filterNodes(const std::list<std::string> &visibleNodes);
+
+    void clearFilter();
+
 signals:
 
     void graphChanged();
@@ -66,9 +74,12 @@ private:
     std::list<std::string> _listOfNode;
     std::list<std::list<std::string>> _listOfList;
     std::list<std::pair<std::string, std::string>> _listOfPair;
+    std::list<std::pair<std::string, double>> _listOfScore;
     int _interval;
 
     void resetAfterDemoAlgo();
+
+    static QColor rampColor(double t);
 };
 
 #endif // GRAPHGRAPHICSSCENE_H
@@ -1,7 +1,9 @@
 #include "graphics/headers/GraphGraphicsScene.h"
 #include "utils/random.h"
+#include <algorithm>
 #include <QDebug>
 #include <memory>
+#include <unordered_set>
 #include <utility>
 
 GraphGraphicsScene::GraphGraphicsScene() = default;
@@ -212,6 +214,62 @@ void GraphGraphicsScene::demoAlgorithm(const std::list<std::list<std::string> >
     }
 }
 
+void GraphGraphicsScene::demoAlgorithm(const std::list<std::pair<std::string, double>> &listOfScoreToDemo,
+                                       GraphDemoFlag flag) {
+    resetAfterDemoAlgo();
+    if (flag != GraphDemoFlag::Ramp || listOfScoreToDemo.empty()) return;
+    _listOfScore = listOfScoreToDemo;
+    // highest scores are coloured first
+    _listOfScore.sort([](const std::pair<std::string, double> &a, const std::pair<std::string, double> &b) {
+        return a.second > b.second;
+    });
+    double high = _listOfScore.front().second, low = _listOfScore.back().second;
+    _uniqueTimer = std::make_unique<QTimer>();
+    connect(_uniqueTimer.get(), &QTimer::timeout, this, [this, low, high]() {
+        if (!this->_listOfScore.empty()) {
+            auto nodeItem = this->nodeItem(this->_listOfScore.front().first);
+            double t = high > low ? (this->_listOfScore.front().second - low) / (high - low) : 1;
+            this->_listOfScore.pop_front();
+            if (nodeItem != nullptr) {
+                nodeItem->setOnSelectedColor(rampColor(t));
+                nodeItem->setSelected(true);
+            }
+            this->update();
+        } else {
+            _uniqueTimer->stop();
+            this->_listOfScore.clear();
+        }
+    });
+    _uniqueTimer->start(_interval);
+}
+
+QColor GraphGraphicsScene::rampColor(double t) {
+    static const QColor stops[] = {QColor(255, 255, 178), QColor(253, 141, 60), QColor(189, 0, 38)};
+    t = std::min(1.0, std::max(0.0, t)) * 2;
+    int i = std::min(1, (int) t);
+    double f = t - i;
+    return QColor((int) (stops[i].red() + f * (stops[i + 1].red() - stops[i].red())),
+                  (int) (stops[i].green() + f * (stops[i + 1].green() - stops[i].green())),
+                  (int) (stops[i].blue() + f * (stops[i + 1].blue() - stops[i].blue())));
+}
+
+void GraphGraphicsScene::filterNodes(const std::list<std::string> &visibleNodes) {
+    std::unordered_set<std::string> visible(visibleNodes.begin(), visibleNodes.end());
+    for (auto &item: _nodeItems)
+        item.second->setVisible(visible.count(item.first) > 0);
+    for (auto &item: _edgeItems)
+        item.second->setVisible(visible.count(item.first.first) > 0 && visible.count(item.first.second) > 0);
+    this->update();
+}
+
+void GraphGraphicsScene::clearFilter() {
+    for (auto &item: _nodeItems)
+        item.second->setVisible(true);
+    for (auto &item: _edgeItems)
+        item.second->setVisible(true);
+    this->update();
+}
+
 void GraphGraphicsScene::resetAfterDemoAlgo() {
     for (auto gi: selectedItems()) {
         if (gi) {
@@ -225,6 +283,7 @@ void GraphGraphicsScene::resetAfterDemoAlgo() {
     this->_listOfList.clear();
     this->_listOfNode.clear();
     this->_listOfPair.clear();
+    this->_listOfScore.clear();
 }
 
 EdgeGraphicsItem *GraphGraphicsScene::edgeItem(const std::string &uname, const std::string &vname) {
@@ -49,6 +49,7 @@ void GraphGraphicsView::contextMenuEvent(QContextMenuEvent *event) {
             menu.addAction("Dijkstra");
             menu.addAction("A-star");
             menu.addAction("Prim");
+            menu.addAction("Distances from here");
             QAction *act = menu.exec(event->globalPos());
             if (act != nullptr) {
                 if (act->text() == "Re&name")
@@ -71,6 +72,8 @@ void GraphGraphicsView::contextMenuEvent(QContextMenuEvent *event) {
                         emit startAlgorithm("A-star", node_name);
                 if (act->text().contains("Prim"))
                         emit startAlgorithm("Prim", node_name);
+                if (act->text().contains("Distances"))
+                        emit startAlgorithm("Distances", node_name);
             } else {
                 item->setSelected(false);
             }
@@ -75,6 +75,8 @@ MainWindow::MainWindow(QWidget *parent) :
             SLOT(demoAlgorithm(std::list<std::string>, GraphDemoFlag)));
     connect(this, SIGNAL(startDemoAlgorithm(std::list<std::pair<std::string, std::string> >, GraphDemoFlag)), _scene,
             SLOT(demoAlgorithm(std::list<std::pair<std::string, std::string> >, GraphDemoFlag)));
+    connect(this, SIGNAL(startDemoAlgorithm(std::list<std::pair<std::string, double> >, GraphDemoFlag)), _scene,
+            SLOT(demoAlgorithm(std::list<std::pair<std::string, double> >, GraphDemoFlag)));
 
     connect(_view, &GraphGraphicsView::nodeAdded, this, [this](QPointF pos, bool auto_naming) {
         if (!auto_naming) {
@@ -126,6 +128,10 @@ MainWindow::MainWindow(QWidget *parent) :
                     auto result = GraphUtils::Prim(this->_graph, source_name);
                     emit startDemoAlgorithm(result, GraphDemoFlag::EdgeAndNode);
 
+                } else if (algo == "Distances") {
+                    this->_ui->consoleText->clear();
+                    auto result = GraphUtils::displayShortestDistances(this->_graph, source_name);
+                    emit startDemoAlgorithm(result, GraphDemoFlag::Ramp);
                 } else if (algo == "Dijkstra") {
                     bool ok;
                     QStringList items;
@@ -490,6 +496,13 @@ void MainWindow::on_coloringBtn_clicked() {
     emit startDemoAlgorithm(result, GraphDemoFlag::Coloring);
 }
 
+void MainWindow::on_chromaticNumberBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayChromaticNumber(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Coloring);
+}
+
 void MainWindow::on_weaklyConnectedBtn_clicked() {
     _ui->consoleText->clear();
     QDebugStream qout(std::cout, _ui->consoleText);
@@ -653,6 +666,10 @@ void MainWindow::on_actionColoring_triggered() {
     on_coloringBtn_clicked();
 }
 
+void MainWindow::on_actionChromatic_number_triggered() {
+    on_chromaticNumberBtn_clicked();
+}
+
 void MainWindow::on_actionTopo_Sorting_triggered() {
     on_topoSortBtn_clicked();
 }
@@ -697,3 +714,187 @@ void MainWindow::on_tabWidget_currentChanged(int index) {
     _elementPropertiesTable->onUnSelected();
 }
 
+void MainWindow::on_cliqueBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayMaximumClique(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Component);
+}
+
+void MainWindow::on_independentSetBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayMaximumIndependentSet(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Component);
+}
+
+void MainWindow::on_actionFind_maximum_clique_triggered() {
+    on_cliqueBtn_clicked();
+}
+
+void MainWindow::on_actionFind_maximum_independent_set_triggered() {
+    on_independentSetBtn_clicked();
+}
+
+void MainWindow::on_closureBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto closure = GraphUtils::displayTransitiveClosure(_graph);
+    if (closure.rows() == _graph->countNodes()) {
+        _adjMatrix->showTransitiveClosure(closure);
+        _ui->tabWidget->setCurrentWidget(_ui->tabAdjMat);
+    }
+}
+
+void MainWindow::on_actionTransitive_closure_triggered() {
+    on_closureBtn_clicked();
+}
+
+void MainWindow::on_maxFlowBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    bool ok{};
+    QStringList labels;
+    labels << "Source: " << "Sink: ";
+    QList<QStringList> itemLists;
+    QStringList items;
+    for (auto node: _graph->nodeList())
+        items << QString::fromStdString(node->name());
+    itemLists << items << items;
+    QList<QString> replies = MultiComboboxDialog::getItems(this, "Maximum flow", labels, itemLists, &ok);
+    if (ok) {
+        replies[0] = replies[0].trimmed();
+        replies[1] = replies[1].trimmed();
+        if (replies[0].isNull() || replies[1].isNull() || replies[0] == replies[1])
+            return;
+        for (auto &reply: replies) {
+            if (!_graph->hasNode(reply.toStdString())) {
+                QMessageBox::critical(this, "Error", tr("No node named ") + reply);
+                return;
+            }
+        }
+        auto result = GraphUtils::displayMaxFlow(_graph, replies[0].toStdString(), replies[1].toStdString());
+        emit startDemoAlgorithm(result, GraphDemoFlag::OnlyEdge);
+    }
+}
+
+void MainWindow::on_actionMaximum_flow_triggered() {
+    on_maxFlowBtn_clicked();
+}
+
+void MainWindow::on_minCutBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayMinimumCut(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Component);
+}
+
+void MainWindow::on_actionGlobal_minimum_cut_triggered() {
+    on_minCutBtn_clicked();
+}
+
+void MainWindow::on_matchingBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayMaximumMatching(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::EdgeAndNode);
+}
+
+void MainWindow::on_actionMaximum_matching_triggered() {
+    on_matchingBtn_clicked();
+}
+
+void MainWindow::on_pageRankBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayPageRank(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Ramp);
+}
+
+void MainWindow::on_actionPageRank_triggered() {
+    on_pageRankBtn_clicked();
+}
+
+void MainWindow::on_eigenvectorBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayEigenvectorCentrality(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Ramp);
+}
+
+void MainWindow::on_actionEigenvector_centrality_triggered() {
+    on_eigenvectorBtn_clicked();
+}
+
+void MainWindow::on_betweennessBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayBetweenness(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Ramp);
+}
+
+void MainWindow::on_actionBetweenness_centrality_triggered() {
+    on_betweennessBtn_clicked();
+}
+
+void MainWindow::on_clusteringBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayClustering(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Ramp);
+}
+
+void MainWindow::on_actionClustering_coefficients_triggered() {
+    on_clusteringBtn_clicked();
+}
+
+void MainWindow::on_kCoreBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    bool ok{};
+    int degeneracy = GraphUtils::getDegeneracy(_graph);
+    int k = QInputDialog::getInt(this, "k-core", "k (0 shows every node):", degeneracy, 0, degeneracy, 1, &ok);
+    if (!ok) return;
+    auto result = GraphUtils::displayKCore(_graph, k);
+    if (k == 0)
+        _scene->clearFilter();
+    else
+        _scene->filterNodes(result);
+}
+
+void MainWindow::on_actionK_core_triggered() {
+    on_kCoreBtn_clicked();
+}
+
+void MainWindow::on_communitiesBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayCommunities(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Component);
+}
+
+void MainWindow::on_actionFind_communities_triggered() {
+    on_communitiesBtn_clicked();
+}
+
+void MainWindow::on_labelPropagationBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayCommunities(_graph, true);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Component);
+}
+
+void MainWindow::on_actionLabel_propagation_triggered() {
+    on_labelPropagationBtn_clicked();
+}
+
+void MainWindow::on_closenessBtn_clicked() {
+    _ui->consoleText->clear();
+    QDebugStream qout(std::cout, _ui->consoleText);
+    auto result = GraphUtils::displayCloseness(_graph);
+    emit startDemoAlgorithm(result, GraphDemoFlag::Ramp);
+}
+
+void MainWindow::on_actionCloseness_centrality_triggered() {
+    on_closenessBtn_clicked();
+}
@@ -59,6 +59,8 @@ private slots:
 
     void on_coloringBtn_clicked();
 
+    void on_chromaticNumberBtn_clicked();
+
     void on_connectedComponentsBtn_clicked();
 
     void on_dijkstraBtn_clicked();
@@ -81,6 +83,8 @@ private slots:
 
     void on_actionColoring_triggered();
 
+    void on_actionChromatic_number_triggered();
+
     void on_actionTopo_Sorting_triggered();
 
     void on_actionEuler_Cycle_triggered();
@@ -105,6 +109,62 @@ private slots:
 
     void on_weaklyConnectedBtn_clicked();
 
+    void on_actionFind_maximum_clique_triggered();
+
+    void on_cliqueBtn_clicked();
+
+    void on_actionFind_maximum_independent_set_triggered();
+
+    void on_independentSetBtn_clicked();
+
+    void on_actionTransitive_closure_triggered();
+
+    void on_closureBtn_clicked();
+
+    void on_actionMaximum_flow_triggered();
+
+    void on_maxFlowBtn_clicked();
+
+    void on_actionGlobal_minimum_cut_triggered();
+
+    void on_minCutBtn_clicked();
+
+    void on_actionMaximum_matching_triggered();
+
+    void on_matchingBtn_clicked();
+
+    void on_actionPageRank_triggered();
+
+    void on_pageRankBtn_clicked();
+
+    void on_actionEigenvector_centrality_triggered();
+
+    void on_eigenvectorBtn_clicked();
+
+    void on_actionBetweenness_centrality_triggered();
+
+    void on_betweennessBtn_clicked();
+
+    void on_actionClustering_coefficients_triggered();
+
+    void on_clusteringBtn_clicked();
+
+    void on_actionK_core_triggered();
+
+    void on_kCoreBtn_clicked();
+
+    void on_actionFind_communities_triggered();
+
+    void on_communitiesBtn_clicked();
+
+    void on_actionLabel_propagation_triggered();
+
+    void on_labelPropagationBtn_clicked();
+
+    void on_actionCloseness_centrality_triggered();
+
+    void on_closenessBtn_clicked();
+
     void on_tabWidget_currentChanged(int index);
 
 signals:
@@ -117,6 +177,8 @@ signals:
 
     void startDemoAlgorithm(std::list<std::list<std::string>> listOfList, GraphDemoFlag flag);
 
+    void startDemoAlgorithm(std::list<std::pair<std::string, double>> listOfScore, GraphDemoFlag flag);
+
 protected:
     void closeEvent(QCloseEvent *event) override;
 
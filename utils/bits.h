@@ -0,0 +1,31 @@
+#ifndef SIMPLE_GRAPH_TOOL_BITS_H
+#define SIMPLE_GRAPH_TOOL_BITS_H
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+class Bits {
+public:
+    static int lowest(std::uint64_t x) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return (int) index;
+#else
+        return __builtin_ctzll(x);
+#endif
+    }
+
+    static int count(std::uint64_t x) {
+#if defined(_MSC_VER)
+        return (int) __popcnt64(x);
+#else
+        return __builtin_popcountll(x);
+#endif
+    }
+};
+
+#endif //SIMPLE_GRAPH_TOOL_BITS_H
@@ -0,0 +1,59 @@
+#ifndef SIMPLE_GRAPH_TOOL_PARALLEL_H
+#define SIMPLE_GRAPH_TOOL_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+class Parallel {
+public:
+    static int threadCount() {
+        static const int count = std::max(1u, std::thread::hardware_concurrency());
+        return count;
+    }
+
+    // Splits [0, n) into one contiguous block per thread and calls fn(thread_id, begin, end).
+    // Small ranges run inline on the calling thread with thread_id 0.
+    template<class Fn>
+    static void forBlocks(int n, Fn fn, int grain = 2048) {
+        int threads = std::min(threadCount(), std::max(1, n / std::max(1, grain)));
+        if (threads <= 1) {
+            if (n > 0) fn(0, 0, n);
+            return;
+        }
+        std::vector<std::thread> workers;
+        int chunk = (n + threads - 1) / threads;
+        for (int t = 1; t < threads; t++) {
+            int begin = std::min(n, t * chunk), end = std::min(n, (t + 1) * chunk);
+            workers.emplace_back([=]() { fn(t, begin, end); });
+        }
+        fn(0, 0, std::min(n, chunk));
+        for (auto &worker: workers)
+            worker.join();
+    }
+
+    // Hands out the indices of [0, n) one at a time and calls fn(thread_id, index); for uneven tasks.
+    template<class Fn>
+    static void forDynamic(int n, Fn fn) {
+        int threads = std::min(threadCount(), n);
+        if (threads <= 1) {
+            for (int i = 0; i < n; i++)
+                fn(0, i);
+            return;
+        }
+        std::atomic<int> next(0);
+        auto work = [&](int tid) {
+            for (int i = next++; i < n; i = next++)
+                fn(tid, i);
+        };
+        std::vector<std::thread> workers;
+        for (int t = 1; t < threads; t++)
+            workers.emplace_back(work, t);
+        work(0);
+        for (auto &worker: workers)
+            worker.join();
+    }
+};
+
+#endif //SIMPLE_GRAPH_TOOL_PARALLEL_H
@@ -0,0 +1,37 @@
+#ifndef SIMPLE_GRAPH_TOOL_REVISIONCACHE_H
+#define SIMPLE_GRAPH_TOOL_REVISIONCACHE_H
+
+// A value derived from one revision of a graph, plus an optional key for results that also depend
+// on a parameter. Revisions are unique across graphs, so a value never leaks to another graph.
+template<class T>
+class RevisionCache {
+public:
+    template<class Graph>
+    bool fresh(const Graph *graph, long long key = 0) const {
+        return _revision == graph->revision() && _key == key;
+    }
+
+    // The value of the graph's current revision, or nullptr when it has not been computed
+    template<class Graph>
+    const T *find(const Graph *graph, long long key = 0) const {
+        return fresh(graph, key) ? &_value : nullptr;
+    }
+
+    // Recomputes with compute() once the graph or key has changed
+    template<class Graph, class Compute>
+    T &get(const Graph *graph, Compute compute, long long key = 0) {
+        if (!fresh(graph, key)) {
+            _value = compute();
+            _revision = graph->revision();
+            _key = key;
+        }
+        return _value;
+    }
+
+private:
+    unsigned long long _revision = 0;
+    long long _key = 0;
+    T _value{};
+};
+
+#endif //SIMPLE_GRAPH_TOOL_REVISIONCACHE_H
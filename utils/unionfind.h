@@ -0,0 +1,110 @@
+#ifndef SIMPLE_GRAPH_TOOL_UNIONFIND_H
+#define SIMPLE_GRAPH_TOOL_UNIONFIND_H
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+class UnionFind {
+public:
+    explicit UnionFind(int n = 0) { reset(n); }
+
+    void reset(int n) {
+        _parent.resize(n);
+        _size.assign(n, 1);
+        for (int i = 0; i < n; i++)
+            _parent[i] = i;
+        _sets = n;
+    }
+
+    // Appends a singleton set and returns its element
+    int add() {
+        _parent.push_back((int) _parent.size());
+        _size.push_back(1);
+        _sets++;
+        return _parent.back();
+    }
+
+    int find(int x) {
+        while (_parent[x] != x) {
+            _parent[x] = _parent[_parent[x]];
+            x = _parent[x];
+        }
+        return x;
+    }
+
+    bool unite(int x, int y) {
+        x = find(x), y = find(y);
+        if (x == y) return false;
+        if (_size[x] < _size[y]) std::swap(x, y);
+        _parent[y] = x;
+        _size[x] += _size[y];
+        _sets--;
+        return true;
+    }
+
+    bool connected(int x, int y) { return find(x) == find(y); }
+
+    int countSets() const { return _sets; }
+
+    int size() const { return (int) _parent.size(); }
+
+private:
+    std::vector<int> _parent;
+    std::vector<int> _size;
+    int _sets = 0;
+};
+
+// Lock-free variant for Shiloach-Vishkin style hooking: unite() may be called from any number of
+// threads at once; roots are always hooked onto the smaller id with a single CAS.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(int n) : _parent(n) {
+        for (int i = 0; i < n; i++)
+            _parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    int find(int x) const {
+        int p = _parent[x].load(std::memory_order_relaxed);
+        while (p != x) {
+            x = p;
+            p = _parent[x].load(std::memory_order_relaxed);
+        }
+        return x;
+    }
+
+    void unite(int x, int y) {
+        int p1 = _parent[x].load(std::memory_order_relaxed);
+        int p2 = _parent[y].load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            int high = std::max(p1, p2), low = std::min(p1, p2);
+            int expected = high;
+            int p_high = _parent[high].load(std::memory_order_relaxed);
+            if (p_high == low)
+                break;
+            if (p_high == high && _parent[high].compare_exchange_strong(expected, low))
+                break;
+            p1 = _parent[_parent[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            p2 = _parent[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Pointer-jumps x straight to its root; safe to run for all x in parallel once unite() calls are done.
+    void compress(int x) {
+        int p = _parent[x].load(std::memory_order_relaxed);
+        while (p != _parent[p].load(std::memory_order_relaxed)) {
+            p = _parent[p].load(std::memory_order_relaxed);
+            _parent[x].store(p, std::memory_order_relaxed);
+        }
+    }
+
+    int parent(int x) const { return _parent[x].load(std::memory_order_relaxed); }
+
+    int size() const { return (int) _parent.size(); }
+
+private:
+    std::vector<std::atomic<int>> _parent;
+};
+
+#endif //SIMPLE_GRAPH_TOOL_UNIONFIND_H
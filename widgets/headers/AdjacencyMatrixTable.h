@@ -2,6 +2,7 @@
 #define GRAPHTABLE_H
 
 #include "basis/headers/Graph.h"
+#include "basis/headers/ClosureEngine.h"
 #include <QTableWidget>
 #include <QHeaderView>
 #include <QKeyEvent>
@@ -12,6 +13,7 @@ private:
     GraphType::Graph *_graph{};
     GraphType::AdjacencyMatrix *_adj{};
     int _sectionSize;
+    bool _closureView = false;
 
 public:
     explicit AdjacencyMatrixTable(GraphType::Graph *graph, int sectionSize = 80);
@@ -22,6 +24,9 @@ public:
 
     GraphType::Graph *graph() const;
 
+    // Read-only heatmap of a closure from GraphUtils::getTransitiveClosure until the next reload()
+    void showTransitiveClosure(const GraphType::BitMatrix &closure);
+
 signals:
 
     void graphChanged();
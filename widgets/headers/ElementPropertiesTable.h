@@ -3,6 +3,8 @@
 
 #include <QTableWidget>
 #include <QHeaderView>
+#include <functional>
+#include <vector>
 #include "basis/headers/Graph.h"
 
 class ElementPropertiesTable : public QTableWidget {
@@ -15,9 +17,23 @@ public:
 
 private:
     GraphType::Graph *_graph;
+    // redraws the selected element after a metric has been computed
+    std::function<void()> _refresh;
+    // by row: computes a graph-wide metric the row is waiting for, empty once it is shown
+    std::vector<std::function<void()>> _compute;
 
     void clearTable();
 
+    void setRow(int row, const QString &text);
+
+    // Shows value() when ready, otherwise offers to run compute() on a double click
+    void setMetricRow(int row, bool ready, const std::function<QString()> &value,
+                      const std::function<void()> &compute);
+
+private slots:
+
+    void onCellDoubleClicked(int row, int column);
+
 public slots:
 
     void onGraphChanged();
@@ -15,6 +15,9 @@ public:
 
     void setGraph(GraphType::Graph *graph);
 
+    // BFS traversals the distance rows may spend on each change
+    static const int traversalBudget = 1024;
+
 private:
     GraphType::Graph *_graph;
 
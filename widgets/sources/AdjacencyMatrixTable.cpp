@@ -1,5 +1,6 @@
 #include "widgets/headers/AdjacencyMatrixTable.h"
 #include <QMessageBox>
+#include <QColor>
 #include <QDebug>
 
 void AdjacencyMatrixTable::defaultSetting() {
@@ -27,6 +28,8 @@ GraphType::Graph *AdjacencyMatrixTable::graph() const {
 
 void AdjacencyMatrixTable::adjustCell(int row, int column) {
 
+    if (_closureView) return;
+
     bool out_of_range = false;
     std::string _strInvalidVal = _graph->invalidValue() != INT_MAX ? std::to_string(_graph->invalidValue()) : "inf";
     QRegExp re("\\d*");
@@ -102,6 +105,7 @@ void AdjacencyMatrixTable::reload() {
     disconnect(this, SIGNAL(cellChanged(int, int)), this, SLOT(adjustCell(int, int)));
     this->clear();
     delete this->_adj;
+    this->_closureView = false;
 
     this->_adj = new GraphType::AdjacencyMatrix(_graph->adjMatrix());
     this->setRowCount(_graph->countNodes());
@@ -136,3 +140,35 @@ void AdjacencyMatrixTable::reload() {
     connect(this, SIGNAL(cellChanged(int, int)), this, SLOT(adjustCell(int, int)));
 }
 
+
+void AdjacencyMatrixTable::showTransitiveClosure(const GraphType::BitMatrix &closure) {
+
+    if (_adj == nullptr || closure.rows() != (int) _adj->nodes().size()) return;
+    int n = closure.rows();
+    disconnect(this, SIGNAL(cellChanged(int, int)), this, SLOT(adjustCell(int, int)));
+    this->_closureView = true;
+
+    // the closure follows nodeList() order while the table sorts its nodes by name
+    std::unordered_map<std::string, int> closure_index;
+    for (auto node: _graph->nodeList())
+        closure_index[node->name()] = (int) closure_index.size();
+    std::vector<int> index(n);
+    for (int i = 0; i < n; i++)
+        index[i] = closure_index[_adj->node(i)->name()];
+
+    // one-way reachability in a light shade, mutual reachability (a shared strong component) darker
+    const QColor one_way(253, 174, 97), mutual(215, 48, 39), none(255, 255, 255);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            bool forward = closure.test(index[i], index[j]), backward = closure.test(index[j], index[i]);
+            auto item = new QTableWidgetItem(forward ? "1" : "0");
+            item->setTextAlignment(Qt::AlignCenter);
+            item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
+            item->setBackground(!forward ? none : backward ? mutual : one_way);
+            item->setToolTip(QString::fromStdString(_adj->node(i)->name()) +
+                             (forward ? " reaches " : " does not reach ") +
+                             QString::fromStdString(_adj->node(j)->name()));
+            this->setItem(i, j, item);
+        }
+    }
+}
@@ -1,4 +1,6 @@
 #include "widgets/headers/ElementPropertiesTable.h"
+#include "basis/headers/GraphUtils.h"
+#include <QTimer>
 
 ElementPropertiesTable::ElementPropertiesTable(GraphType::Graph *graph, int sectionSize) {
     this->_graph = graph;
@@ -8,6 +10,7 @@ ElementPropertiesTable::ElementPropertiesTable(GraphType::Graph *graph, int sect
     this->verticalHeader()->setCascadingSectionResizes(false);
     this->horizontalHeader()->setStretchLastSection(true);
     this->horizontalHeader()->hide();
+    connect(this, &QTableWidget::cellDoubleClicked, this, &ElementPropertiesTable::onCellDoubleClicked);
 }
 
 ElementPropertiesTable::ElementPropertiesTable(GraphType::Graph *graph) : ElementPropertiesTable(graph, 48) {}
@@ -19,6 +22,36 @@ void ElementPropertiesTable::setGraph(GraphType::Graph *graph) {
 void ElementPropertiesTable::clearTable() {
     this->setRowCount(0);
     this->setColumnCount(0);
+    this->_refresh = nullptr;
+    this->_compute.clear();
+}
+
+void ElementPropertiesTable::setRow(int row, const QString &text) {
+    this->setItem(row, 0, new QTableWidgetItem(text));
+    this->item(row, 0)->setTextAlignment(Qt::AlignCenter);
+    this->item(row, 0)->setFlags(Qt::ItemIsEnabled);
+}
+
+void ElementPropertiesTable::setMetricRow(int row, bool ready, const std::function<QString()> &value,
+                                          const std::function<void()> &compute) {
+    if ((int) this->_compute.size() < this->rowCount())
+        this->_compute.resize(this->rowCount());
+    if (ready) {
+        setRow(row, value());
+        return;
+    }
+    // graph-wide metrics can take seconds on large graphs, so a click never starts one by itself
+    setRow(row, tr("double-click to compute"));
+    this->item(row, 0)->setForeground(Qt::gray);
+    this->_compute[row] = compute;
+}
+
+void ElementPropertiesTable::onCellDoubleClicked(int row, int) {
+    if (row >= (int) this->_compute.size() || !this->_compute[row]) return;
+    this->_compute[row]();
+    // redrawn once the click has been handled, since that replaces the clicked item
+    if (this->_refresh)
+        QTimer::singleShot(0, this, this->_refresh);
 }
 
 void ElementPropertiesTable::onGraphChanged() {
@@ -33,60 +66,72 @@ void ElementPropertiesTable::onNodeSelected(const std::string &node_name) {
     clearTable();
     QStringList tableHeader;
     if (this->_graph->isDirected()) {
-        this->setRowCount(3);
+        this->setRowCount(10);
         tableHeader << tr("Name") << tr("Positive degree") << tr("Negative degree");
     } else {
-        this->setRowCount(2);
+        this->setRowCount(9);
         tableHeader << tr("Name") << tr("Degree");
     }
+    tableHeader << tr("PageRank") << tr("Eigenvector centrality") << tr("Betweenness")
+                << tr("Clustering coefficient") << tr("Core number") << tr("Eccentricity")
+                << tr("Closeness centrality");
     this->setColumnCount(1);
     this->setVerticalHeaderLabels(tableHeader);
+    this->_refresh = [this, node_name]() { onNodeSelected(node_name); };
 
-    this->setItem(0, 0, new QTableWidgetItem());
-    this->item(0, 0)->setTextAlignment(Qt::AlignCenter);
-    this->item(0, 0)->setText(QString::fromStdString(node_name));
-    this->item(0, 0)->setFlags(Qt::ItemIsEnabled);
-
+    setRow(0, QString::fromStdString(node_name));
     if (this->_graph->isDirected()) {
-        this->setItem(1, 0, new QTableWidgetItem());
-        this->item(1, 0)->setTextAlignment(Qt::AlignCenter);
-        this->item(1, 0)->setText(QString::number(this->_graph->node(node_name)->posDegree()));
-        this->item(1, 0)->setFlags(Qt::ItemIsEnabled);
-
-        this->setItem(2, 0, new QTableWidgetItem());
-        this->item(2, 0)->setTextAlignment(Qt::AlignCenter);
-        this->item(2, 0)->setText(QString::number(this->_graph->node(node_name)->negDegree()));
-        this->item(2, 0)->setFlags(Qt::ItemIsEnabled);
+        setRow(1, QString::number(this->_graph->node(node_name)->posDegree()));
+        setRow(2, QString::number(this->_graph->node(node_name)->negDegree()));
     } else {
-        this->setItem(1, 0, new QTableWidgetItem());
-        this->item(1, 0)->setTextAlignment(Qt::AlignCenter);
-        this->item(1, 0)->setText(QString::number(this->_graph->node(node_name)->undirDegree()));
-        this->item(1, 0)->setFlags(Qt::ItemIsEnabled);
+        setRow(1, QString::number(this->_graph->node(node_name)->undirDegree()));
     }
+
+    auto graph = this->_graph;
+    int row = this->rowCount() - 7;
+    bool centrality = GraphUtils::hasCentrality(graph);
+    auto computeCentrality = [graph]() { GraphUtils::getPageRank(graph); };
+    setMetricRow(row, centrality, [&]() {
+        return QString::number(GraphUtils::getPageRank(graph, node_name), 'g', 6);
+    }, computeCentrality);
+    setMetricRow(row + 1, centrality, [&]() {
+        return QString::number(GraphUtils::getEigenvectorCentrality(graph, node_name), 'g', 6);
+    }, computeCentrality);
+    setMetricRow(row + 2, GraphUtils::hasBetweenness(graph), [&]() {
+        return QString::number(GraphUtils::getBetweenness(graph, node_name), 'g', 6);
+    }, [graph]() { GraphUtils::getBetweenness(graph); });
+    setMetricRow(row + 3, GraphUtils::hasClustering(graph), [&]() {
+        return QString::number(GraphUtils::getClusteringCoefficient(graph, node_name), 'g', 6);
+    }, [graph]() { GraphUtils::getTriangleCount(graph); });
+    setMetricRow(row + 4, GraphUtils::hasCoreNumbers(graph), [&]() {
+        return QString::number(GraphUtils::getCoreNumber(graph, node_name));
+    }, [graph]() { GraphUtils::getDegeneracy(graph); });
+
+    bool distances = GraphUtils::hasDistances(graph, node_name);
+    auto computeDistances = [graph, node_name]() { GraphUtils::getEccentricity(graph, node_name); };
+    setMetricRow(row + 5, distances, [&]() {
+        return QString::number(GraphUtils::getEccentricity(graph, node_name));
+    }, computeDistances);
+    setMetricRow(row + 6, distances, [&]() {
+        return QString::number(GraphUtils::getClosenessCentrality(graph, node_name), 'g', 6);
+    }, computeDistances);
 }
 
 void ElementPropertiesTable::onEdgeSelected(const std::string &uname, const std::string &vname) {
     clearTable();
     QStringList tableHeader;
-    tableHeader << tr("From node") << tr("To node") << tr("Weight");
-    this->setRowCount(3);
+    tableHeader << tr("From node") << tr("To node") << tr("Weight") << tr("Betweenness");
+    this->setRowCount(4);
     this->setColumnCount(1);
     this->setVerticalHeaderLabels(tableHeader);
+    this->_refresh = [this, uname, vname]() { onEdgeSelected(uname, vname); };
 
-    this->setItem(0, 0, new QTableWidgetItem());
-    this->item(0, 0)->setTextAlignment(Qt::AlignCenter);
-    this->item(0, 0)->setText(QString::fromStdString(uname));
-    this->item(0, 0)->setFlags(Qt::ItemIsEnabled);
-
-    this->setItem(1, 0, new QTableWidgetItem());
-    this->item(1, 0)->setTextAlignment(Qt::AlignCenter);
-    this->item(1, 0)->setText(QString::fromStdString(vname));
-    this->item(1, 0)->setFlags(Qt::ItemIsEnabled);
-
-    this->setItem(2, 0, new QTableWidgetItem());
-    this->item(2, 0)->setTextAlignment(Qt::AlignCenter);
-    this->item(2, 0)->setText((this->_graph->weight(uname, vname) != INT_MAX) ?
-                              QString::number(this->_graph->weight(uname, vname))
-                                                                              : "inf");
-    this->item(2, 0)->setFlags(Qt::ItemIsEnabled);
+    setRow(0, QString::fromStdString(uname));
+    setRow(1, QString::fromStdString(vname));
+    setRow(2, (this->_graph->weight(uname, vname) != INT_MAX) ? QString::number(this->_graph->weight(uname, vname))
+                                                              : "inf");
+    auto graph = this->_graph;
+    setMetricRow(3, GraphUtils::hasBetweenness(graph), [&]() {
+        return QString::number(GraphUtils::getEdgeBetweenness(graph, uname, vname), 'g', 6);
+    }, [graph]() { GraphUtils::getBetweenness(graph); });
 }
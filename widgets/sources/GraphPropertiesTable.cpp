@@ -1,4 +1,5 @@
 #include "widgets/headers/GraphPropertiesTable.h"
+#include "basis/headers/GraphUtils.h"
 
 GraphPropertiesTable::GraphPropertiesTable(GraphType::Graph *graph, int sectionSize) {
     setGraph(graph);
@@ -12,9 +13,12 @@ GraphPropertiesTable::GraphPropertiesTable(GraphType::Graph *graph, int sectionS
 
 void GraphPropertiesTable::setGraph(GraphType::Graph *graph) {
     this->_graph = graph;
+    // the component count below is refreshed on every edit
+    this->_graph->trackComponents();
     QStringList tableHeader;
-    tableHeader << tr("Total node(s)") << tr("Total edge(s)") << tr("Weighted") << tr("Directed");
-    this->setRowCount(4);
+    tableHeader << tr("Total node(s)") << tr("Total edge(s)") << tr("Weighted") << tr("Directed")
+                << tr("Component(s)") << tr("Diameter") << tr("Radius");
+    this->setRowCount(7);
     this->setColumnCount(1);
     this->setVerticalHeaderLabels(tableHeader);
 
@@ -23,10 +27,9 @@ void GraphPropertiesTable::setGraph(GraphType::Graph *graph) {
         this->item(i, 0)->setTextAlignment(Qt::AlignCenter);
         this->item(i, 0)->setFlags(Qt::ItemIsEnabled);
     }
-    this->item(0, 0)->setText(QString::number(this->_graph->countNodes()));
-    this->item(1, 0)->setText(QString::number(this->_graph->countEdges()));
     this->item(2, 0)->setText(QVariant(_graph->isWeighted()).toString());
     this->item(3, 0)->setText(QVariant(_graph->isDirected()).toString());
+    onGraphChanged();
 }
 
 GraphPropertiesTable::GraphPropertiesTable(GraphType::Graph *graph) : GraphPropertiesTable(graph, 48) {}
@@ -34,5 +37,18 @@ GraphPropertiesTable::GraphPropertiesTable(GraphType::Graph *graph) : GraphPrope
 void GraphPropertiesTable::onGraphChanged() {
     this->item(0, 0)->setText(QString::number(this->_graph->countNodes()));
     this->item(1, 0)->setText(QString::number(this->_graph->countEdges()));
+    this->item(4, 0)->setText(QString::number(this->_graph->countComponents()));
+    // small graphs get exact distances; beyond the budget only diameter bounds, so an edit never
+    // costs more than about traversalBudget BFS traversals
+    if (this->_graph->countNodes() <= traversalBudget) {
+        this->item(5, 0)->setText(QString::number(GraphUtils::getDiameter(this->_graph)));
+        this->item(6, 0)->setText(QString::number(GraphUtils::getRadius(this->_graph)));
+        return;
+    }
+    auto diameter = GraphUtils::getDiameterBounds(this->_graph, traversalBudget);
+    if (diameter.first == diameter.second)
+        this->item(5, 0)->setText(QString::number(diameter.first));
+    else
+        this->item(5, 0)->setText(QString("%1..%2").arg(diameter.first).arg(diameter.second));
+    this->item(6, 0)->setText(tr("n/a"));
 }
-